@@ -49,6 +49,7 @@
 #include <iterator>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <memory>
 
@@ -939,6 +940,26 @@ public:
    */
   void set_verify_dirichlet_bc_consistency(bool val);
 
+  /**
+   * If \p cache is true, every distribute_dofs() finishes by storing
+   * the dof indices of each active element on this processor, for all
+   * variables and for each variable, in compressed row storage.
+   * dof_indices() on those elements then copies out the stored lists
+   * instead of walking nodes, variable groups and SCALAR dofs again.
+   *
+   * The stored lists are only valid until the mesh or the dof
+   * numbering next changes, which must be followed by another
+   * distribute_dofs() as usual.  This is off by default; turning it on
+   * after dofs have been distributed builds the lists immediately.
+   */
+  void cache_elem_dof_indices (bool cache);
+
+  /**
+   * \returns Whether element dof indices are cached.
+   */
+  bool caching_elem_dof_indices () const
+  { return _cache_elem_dof_indices; }
+
   /**
    * Tells other library functions whether or not this problem
    * includes coupling between dofs in neighboring cells, as can
@@ -1116,12 +1137,14 @@ public:
   void stash_dof_constraints()
   {
     libmesh_assert(_stashed_dof_constraints.empty());
+    this->clear_frozen_constraints();
     _dof_constraints.swap(_stashed_dof_constraints);
   }
 
   void unstash_dof_constraints()
   {
     libmesh_assert(_dof_constraints.empty());
+    this->clear_frozen_constraints();
     _dof_constraints.swap(_stashed_dof_constraints);
   }
 
@@ -1139,9 +1162,30 @@ public:
    */
   void swap_dof_constraints()
   {
+    this->clear_frozen_constraints();
     _dof_constraints.swap(_stashed_dof_constraints);
   }
 
+  /**
+   * If \p freeze is true, every process_constraints() finishes by
+   * copying the constraint rows into compressed row storage, with a
+   * dense table finding the row of each locally owned dof.  The
+   * element constraint methods and enforce_constraints_exactly() then
+   * read rows from there instead of searching the DofConstraints map.
+   *
+   * The frozen rows are dropped whenever the constraints change, and
+   * rebuilt by the next process_constraints().  This is off by
+   * default; turning it on after constraints have been processed
+   * freezes them immediately.
+   */
+  void freeze_constraints (bool freeze);
+
+  /**
+   * \returns Whether constraints are frozen after processing.
+   */
+  bool freezing_constraints () const
+  { return _freeze_constraints; }
+
 #ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
   /**
    * \returns An iterator pointing to the first Node constraint row.
@@ -1233,6 +1277,25 @@ public:
   std::pair<Real, Real> max_constraint_error(const System & system,
                                              NumericVector<Number> * v = nullptr) const;
 
+  /**
+   * Build the constraint matrix C associated with the element
+   * degree of freedom indices elem_dofs. The optional parameter
+   * \p called_recursively should be left at the default value
+   * \p false.  This is used to handle the special case of
+   * an element's degrees of freedom being constrained in terms
+   * of other, local degrees of freedom.  The usual case is
+   * for an elements DOFs to be constrained by some other,
+   * external DOFs.
+   *
+   * \p elem_dofs is extended with any DOFs it is constrained in terms
+   * of, and C is left untouched if none of the element DOFs are
+   * constrained.  Code applying the same constraints repeatedly can
+   * keep C rather than have constrain_element_matrix() rebuild it.
+   */
+  void build_constraint_matrix (DenseMatrix<Number> & C,
+                                std::vector<dof_id_type> & elem_dofs,
+                                const bool called_recursively=false) const;
+
 #endif // LIBMESH_ENABLE_CONSTRAINTS
 
   //--------------------------------------------------------------------
@@ -1893,20 +1956,6 @@ private:
 
 #ifdef LIBMESH_ENABLE_CONSTRAINTS
 
-  /**
-   * Build the constraint matrix C associated with the element
-   * degree of freedom indices elem_dofs. The optional parameter
-   * \p called_recursively should be left at the default value
-   * \p false.  This is used to handle the special case of
-   * an element's degrees of freedom being constrained in terms
-   * of other, local degrees of freedom.  The usual case is
-   * for an elements DOFs to be constrained by some other,
-   * external DOFs.
-   */
-  void build_constraint_matrix (DenseMatrix<Number> & C,
-                                std::vector<dof_id_type> & elem_dofs,
-                                const bool called_recursively=false) const;
-
   /**
    * Build the constraint matrix C and the forcing vector H
    * associated with the element degree of freedom indices elem_dofs.
@@ -1954,6 +2003,55 @@ private:
    */
   void process_mesh_constraint_rows(const MeshBase & mesh);
 
+  /**
+   * Sorts the constrained dofs into \p levels, such that each row
+   * refers only to constrained dofs on earlier levels.
+   *
+   * \returns \p false, leaving \p levels empty, if the constraints
+   * contain a loop and so can't be sorted.
+   */
+  bool constraint_expansion_levels (std::vector<std::vector<dof_id_type>> & levels) const;
+
+  /**
+   * Expands constraint rows and right hand sides in terms of
+   * unconstrained dofs only, one level of rows at a time, in
+   * parallel within each level.
+   */
+  void expand_constraints_by_level (const std::vector<std::vector<dof_id_type>> & levels);
+
+  /**
+   * Expands constraint rows and right hand sides in terms of
+   * unconstrained dofs only, by repeatedly substituting constraint
+   * rows until no constrained dofs are left.  This copes with
+   * constraint loops, for which expand_constraints_by_level() can't
+   * be used.
+   */
+  void expand_constraints_iteratively ();
+
+  /**
+   * Copies the current constraint rows into the frozen storage.
+   */
+  void build_frozen_constraints ();
+
+  /**
+   * Drops any frozen constraint rows, so that the DofConstraints map
+   * is used again.
+   */
+  void clear_frozen_constraints ();
+
+  /**
+   * \returns The frozen row of \p dof, or \p invalid_uint if \p dof
+   * is unconstrained.  Only valid while constraints are frozen.
+   */
+  unsigned int frozen_constraint_row (const dof_id_type dof) const;
+
+  /**
+   * Calls \p f(constraining_dof, coefficient) for each entry in the
+   * constraint row of \p dof, which must be constrained.
+   */
+  template <typename Func>
+  void for_each_constraint_entry (const dof_id_type dof, Func && f) const;
+
 #endif // LIBMESH_ENABLE_CONSTRAINTS
 
   /**
@@ -2168,6 +2266,27 @@ private:
   DofConstraintValueMap      _primal_constraint_values;
 
   AdjointDofConstraintValues _adjoint_constraint_values;
+
+  /**
+   * Whether process_constraints() should freeze constraint rows.
+   */
+  bool _freeze_constraints;
+
+  /**
+   * The frozen constraint rows, when there are any.  Row r constrains
+   * _frozen_row_dofs[r], which are sorted, in terms of the dofs in
+   * _frozen_constraining_dofs[_frozen_row_offsets[r]] up to
+   * _frozen_constraining_dofs[_frozen_row_offsets[r+1]], with the
+   * coefficients in the same positions of _frozen_constraint_coefs.
+   * _frozen_local_rows[i] is the row of dof first_dof()+i, or
+   * invalid_uint.  _frozen_row_offsets is empty unless we are frozen.
+   */
+  std::vector<dof_id_type> _frozen_row_dofs;
+  std::vector<std::size_t> _frozen_row_offsets;
+  std::vector<dof_id_type> _frozen_constraining_dofs;
+  std::vector<Real> _frozen_constraint_coefs;
+  std::vector<unsigned int> _frozen_local_rows;
+  dof_id_type _frozen_first_dof;
 #endif
 
 #ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
@@ -2209,6 +2328,49 @@ private:
   bool _implicit_neighbor_dofs_initialized;
   bool _implicit_neighbor_dofs;
 
+  /**
+   * Whether distribute_dofs() should cache element dof indices.
+   */
+  bool _cache_elem_dof_indices;
+
+  /**
+   * Cached element dof indices.  Element \p elem with row
+   * r = _elem_dof_rows[elem->id()] has the dof indices of variable v in
+   * _elem_dof_indices[_elem_dof_offsets[r*(nv+1)+v]] up to
+   * _elem_dof_indices[_elem_dof_offsets[r*(nv+1)+v+1]], where nv is
+   * the number of variables.  All variables' indices together are the
+   * whole range for the row, in the same order dof_indices() uses.
+   * Elements without a row have \p invalid_elem_dof_row instead.
+   */
+  std::vector<std::size_t> _elem_dof_rows;
+  static constexpr std::size_t invalid_elem_dof_row = static_cast<std::size_t>(-1);
+  std::vector<std::size_t> _elem_dof_offsets;
+  std::vector<dof_id_type> _elem_dof_indices;
+
+  /**
+   * The mesh generation() the element dof index cache was built for.
+   * Rows are indexed by element id, so once the mesh has changed
+   * (e.g. been renumbered or repartitioned) the cache is ignored.
+   */
+  std::size_t _elem_dof_cache_generation = 0;
+
+  /**
+   * Fills the element dof index cache for the active elements of \p mesh.
+   */
+  void build_elem_dof_cache (const MeshBase & mesh);
+
+  /**
+   * Empties the element dof index cache.
+   */
+  void clear_elem_dof_cache ();
+
+  /**
+   * \returns A pointer to the n_variables()+1 offsets for \p elem in
+   * the dof index cache, or \p nullptr if it has none or the mesh has
+   * changed since the cache was built.
+   */
+  const std::size_t * elem_dof_cache_offsets (const Elem * elem) const;
+
   /**
    * Flag which determines whether we should do some additional
    * checking of the consistency of the DirichletBoundary objects
@@ -2317,6 +2479,9 @@ bool DofMap::is_constrained_node (const Node *
 inline
 bool DofMap::is_constrained_dof (const dof_id_type dof) const
 {
+  if (!_frozen_row_offsets.empty())
+    return this->frozen_constraint_row(dof) != libMesh::invalid_uint;
+
   if (_dof_constraints.count(dof))
     return true;
 
@@ -2324,6 +2489,50 @@ bool DofMap::is_constrained_dof (const dof_id_type dof) const
 }
 
 
+inline
+unsigned int DofMap::frozen_constraint_row (const dof_id_type dof) const
+{
+  libmesh_assert(!_frozen_row_offsets.empty());
+
+  if (dof >= _frozen_first_dof &&
+      dof - _frozen_first_dof < _frozen_local_rows.size())
+    return _frozen_local_rows[dof - _frozen_first_dof];
+
+  const auto it = std::lower_bound(_frozen_row_dofs.begin(),
+                                   _frozen_row_dofs.end(), dof);
+  if (it == _frozen_row_dofs.end() || *it != dof)
+    return libMesh::invalid_uint;
+
+  return cast_int<unsigned int>(std::distance(_frozen_row_dofs.begin(), it));
+}
+
+
+template <typename Func>
+inline
+void DofMap::for_each_constraint_entry (const dof_id_type dof,
+                                        Func && f) const
+{
+  if (!_frozen_row_offsets.empty())
+    {
+      const unsigned int row = this->frozen_constraint_row(dof);
+      libmesh_assert_not_equal_to (row, libMesh::invalid_uint);
+
+      for (std::size_t k = _frozen_row_offsets[row],
+           end = _frozen_row_offsets[row+1]; k != end; ++k)
+        f(_frozen_constraining_dofs[k], _frozen_constraint_coefs[k]);
+
+      return;
+    }
+
+  DofConstraints::const_iterator pos = _dof_constraints.find(dof);
+
+  libmesh_assert (pos != _dof_constraints.end());
+
+  for (const auto & [constraining_dof, coef] : pos->second)
+    f(constraining_dof, coef);
+}
+
+
 inline
 bool DofMap::has_heterogeneous_adjoint_constraints (const unsigned int qoi_num) const
 {
@@ -21,6 +21,7 @@
 #define LIBMESH_DOF_OBJECT_H
 
 // Local includes
+#include "libmesh/dof_object_index_buffer.h"
 #include "libmesh/id_types.h"
 #include "libmesh/int_range.h"
 #include "libmesh/libmesh_config.h"
@@ -517,6 +518,32 @@ public:
    */
   void pack_indexing(std::back_insert_iterator<std::vector<largest_id_type>> target) const;
 
+  /**
+   * \returns The number of entries in our index buffer, i.e. how much
+   * room it needs in a contiguous array of index buffers.
+   */
+  unsigned int index_buffer_size () const
+  { return _idx_buf.size(); }
+
+  /**
+   * Copies our index buffer into \p storage, which must have room for
+   * index_buffer_size() entries, and uses that copy from now on.  The
+   * caller must keep \p storage alive until this object is destroyed,
+   * relocated again, or changes its buffer size (at which point it
+   * switches back to a heap allocation of its own).
+   *
+   * This is used by MeshBase::pack_dof_object_indexing().
+   */
+  void relocate_index_buffer (dof_id_type * storage)
+  { _idx_buf.relocate(storage); }
+
+  /**
+   * \returns \p true if our index buffer lives in storage passed to
+   * relocate_index_buffer().
+   */
+  bool index_buffer_is_external () const
+  { return _idx_buf.is_external(); }
+
   /**
    * Print our buffer for debugging.
    */
@@ -672,9 +699,13 @@ private:
    * [-5 11 11 13 17 () (ncv_0 idx_0 ncv_1 idx_1 ncv_2 idx_2) () (ncv_0 idx_0) (ncv_0 idx_0 ncv_1 idx_1) (xtra1 xtra2)]
    * [0   1  2  3  4         5     6     7     8     9    10         11    12      13    14    15    16      17    18]
    * \endverbatim
+   *
+   * The buffer is normally a heap allocation of its own, but may
+   * instead be a slice of a contiguous mesh-wide array; see
+   * relocate_index_buffer().
    */
   typedef dof_id_type index_t;
-  typedef std::vector<index_t> index_buffer_t;
+  typedef DofObjectIndexBuffer index_buffer_t;
   index_buffer_t _idx_buf;
 
   /**
@@ -713,7 +744,7 @@ private:
 #ifdef LIBMESH_IS_UNIT_TESTING
 public:
   void set_buffer (const std::vector<dof_id_type> & buf)
-  { _idx_buf = buf; }
+  { _idx_buf.assign(buf.begin(), buf.end()); }
 #endif
 };
 
@@ -0,0 +1,269 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_DOF_OBJECT_INDEX_BUFFER_H
+#define LIBMESH_DOF_OBJECT_INDEX_BUFFER_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+
+// C++ includes
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * The storage behind a \p DofObject's index buffer.
+ *
+ * This behaves like the subset of \p std::vector<dof_id_type> that
+ * \p DofObject needs, but it either owns a heap allocation, which
+ * grows geometrically as entries are inserted, or refers to a slice
+ * of storage owned by someone else, typically the contiguous mesh-wide
+ * array built by \p MeshBase::pack_dof_object_indexing().
+ *
+ * External storage may be read and overwritten in place.  Any
+ * operation which changes the size of the buffer first copies the
+ * buffer back into storage of its own, after which the external slice
+ * is no longer referenced.  Copies are always made into owned storage.
+ *
+ * \brief Owned or externally stored DofObject indexing.
+ */
+class DofObjectIndexBuffer
+{
+public:
+  typedef dof_id_type value_type;
+  typedef dof_id_type * iterator;
+  typedef const dof_id_type * const_iterator;
+  typedef unsigned int size_type;
+
+  DofObjectIndexBuffer () :
+    _data(nullptr),
+    _size(0),
+    _capacity(0)
+  {}
+
+  DofObjectIndexBuffer (const DofObjectIndexBuffer & other) :
+    DofObjectIndexBuffer()
+  {
+    this->assign(other.begin(), other.end());
+  }
+
+  DofObjectIndexBuffer & operator= (const DofObjectIndexBuffer & other)
+  {
+    if (&other != this)
+      this->assign(other.begin(), other.end());
+    return *this;
+  }
+
+  ~DofObjectIndexBuffer () { this->release(); }
+
+  size_type size () const { return _size; }
+
+  bool empty () const { return !_size; }
+
+  dof_id_type & operator[] (size_type i)
+  {
+    libmesh_assert_less(i, _size);
+    return _data[i];
+  }
+
+  dof_id_type operator[] (size_type i) const
+  {
+    libmesh_assert_less(i, _size);
+    return _data[i];
+  }
+
+  iterator begin () { return _data; }
+  iterator end () { return _data + _size; }
+  const_iterator begin () const { return _data; }
+  const_iterator end () const { return _data + _size; }
+
+  /**
+   * \returns \p true if the buffer lives in storage owned by someone
+   * else.
+   */
+  bool is_external () const { return _size && !_capacity; }
+
+  /**
+   * Replaces the contents with the range [first, last), in owned
+   * storage of exactly the needed size.
+   */
+  template <typename InputIterator>
+  void assign (InputIterator first, InputIterator last)
+  {
+    const size_type n = cast_int<size_type>(std::distance(first, last));
+    dof_id_type * new_data = n ? new dof_id_type[n] : nullptr;
+    std::copy(first, last, new_data);
+    this->release();
+    _data = new_data;
+    _size = _capacity = n;
+  }
+
+  /**
+   * Empties the buffer, releasing any storage it owns.
+   */
+  void clear ()
+  {
+    this->release();
+    _size = 0;
+  }
+
+  void reserve (size_type n)
+  {
+    if (n > _capacity || this->is_external())
+      this->reallocate(std::max(n, _size));
+  }
+
+  void resize (size_type n, dof_id_type value = 0)
+  {
+    this->grow(n);
+    if (n > _size)
+      std::fill(_data + _size, _data + n, value);
+    _size = n;
+  }
+
+  iterator insert (const_iterator pos, dof_id_type value)
+  {
+    return this->insert(pos, &value, &value + 1);
+  }
+
+  template <typename InputIterator>
+  iterator insert (const_iterator pos, InputIterator first, InputIterator last)
+  {
+    const size_type offset = cast_int<size_type>(pos - _data);
+    const size_type n = cast_int<size_type>(std::distance(first, last));
+    libmesh_assert_less_equal(offset, _size);
+
+    // If the new entries are our own, copy them out first, since
+    // making room for them would move or overwrite them
+    if constexpr (std::is_convertible_v<InputIterator, const dof_id_type *>)
+      {
+        const std::less<const dof_id_type *> less;
+        if (n && less(first, _data + _size) && less(_data, last))
+          {
+            const std::vector<dof_id_type> values(first, last);
+            return this->insert(pos, values.data(), values.data() + n);
+          }
+      }
+
+    this->grow(_size + n);
+    std::copy_backward(_data + offset, _data + _size, _data + _size + n);
+    std::copy(first, last, _data + offset);
+    _size += n;
+
+    return _data + offset;
+  }
+
+  iterator erase (const_iterator first, const_iterator last)
+  {
+    const size_type offset = cast_int<size_type>(first - _data);
+    const size_type n = cast_int<size_type>(last - first);
+    libmesh_assert_less_equal(offset + n, _size);
+
+    if (this->is_external())
+      this->reallocate(_size);
+
+    std::copy(_data + offset + n, _data + _size, _data + offset);
+    _size -= n;
+
+    return _data + offset;
+  }
+
+  /**
+   * Releases any owned capacity beyond the current size.
+   */
+  void shrink_to_fit ()
+  {
+    if (_capacity > _size)
+      this->reallocate(_size);
+  }
+
+  /**
+   * Copies the buffer into \p storage, which must have room for
+   * size() entries, and refers to it from now on.  The caller is
+   * responsible for keeping \p storage alive until the buffer is
+   * relocated again, resized, or destroyed.
+   */
+  void relocate (dof_id_type * storage)
+  {
+    if (!_size)
+      {
+        this->clear();
+        return;
+      }
+
+    libmesh_assert(storage);
+    std::copy(_data, _data + _size, storage);
+    this->release();
+    _data = storage;
+  }
+
+private:
+
+  /**
+   * Makes room for \p n entries in owned storage, growing
+   * geometrically so that repeated inserts take amortized constant
+   * time, as they would with a std::vector.
+   */
+  void grow (size_type n)
+  {
+    if (n > _capacity || this->is_external())
+      this->reallocate(std::max({n, _size, 2*_capacity}));
+  }
+
+  void reallocate (size_type new_capacity)
+  {
+    libmesh_assert_greater_equal(new_capacity, _size);
+    dof_id_type * new_data = new_capacity ? new dof_id_type[new_capacity] : nullptr;
+    std::copy(_data, _data + _size, new_data);
+    this->release();
+    _data = new_data;
+    _capacity = new_capacity;
+  }
+
+  /**
+   * Frees any owned storage.  Leaves _size untouched.
+   */
+  void release ()
+  {
+    if (_capacity)
+      delete [] _data;
+    _data = nullptr;
+    _capacity = 0;
+  }
+
+  dof_id_type * _data;
+
+  size_type _size;
+
+  /**
+   * The size of our own allocation, or 0 if we do not own _data.
+   */
+  size_type _capacity;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_DOF_OBJECT_INDEX_BUFFER_H
@@ -137,6 +137,15 @@ public:
    */
   void join (const Build & other);
 
+  /**
+   * Take over the sparsity pattern in \p other, which is left empty.
+   * This is the overload multithreaded loops use.  Rather than
+   * merging every local row serially here, we keep the other
+   * thread's rows aside, and parallel_sync() merges all of them at
+   * once, in parallel over rows.
+   */
+  void join (Build & other);
+
   /**
    * Send sparsity pattern data relevant to other processors to those
    * processors, and receive and incorporate data relevant to us.
@@ -200,6 +209,7 @@ public:
   void clear_full_sparsity()
   {
     sparsity_pattern.clear();
+    joined_patterns.clear();
     nonlocal_pattern.clear();
   }
 
@@ -234,6 +244,23 @@ private:
                              std::vector<dof_id_type> & dofs_vi,
                              unsigned int vi);
 
+  /**
+   * Adds the local rows of \p other_pattern to sparsity_pattern.
+   */
+  void add_local_rows (const SparsityPattern::Graph & other_pattern);
+
+  /**
+   * Merges the rows of joined_patterns into sparsity_pattern, on
+   * multiple threads.
+   */
+  void merge_joined_patterns();
+
+  /**
+   * Local rows taken over from other threads' Build objects, which
+   * have not yet been merged into sparsity_pattern.
+   */
+  std::vector<SparsityPattern::Graph> joined_patterns;
+
 #ifndef LIBMESH_ENABLE_DEPRECATED
 private:
 #endif
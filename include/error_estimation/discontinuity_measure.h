@@ -73,6 +73,8 @@ public:
 
   /**
    * Register a user function to use in computing the essential BCs.
+   * The function need not be thread-safe: while one is attached,
+   * errors are estimated on a single thread.
    */
   void attach_essential_bc_function (std::pair<bool,Real> fptr(const System & system,
                                                                const Point & p,
@@ -82,6 +84,12 @@ public:
 
 protected:
 
+  /**
+   * \returns A new estimator with the same settings, for use by
+   * another thread.
+   */
+  virtual std::unique_ptr<JumpErrorEstimator> clone_for_thread() const override;
+
   /**
    * An initialization function, for requesting specific data from the FE
    * objects
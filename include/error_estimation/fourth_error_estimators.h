@@ -67,6 +67,12 @@ public:
 
 protected:
 
+  /**
+   * \returns A new estimator with the same settings, for use by
+   * another thread.
+   */
+  virtual std::unique_ptr<JumpErrorEstimator> clone_for_thread() const override;
+
   /**
    * An initialization function, for requesting specific data from the FE
    * objects
@@ -22,14 +22,17 @@
 
 // Local Includes
 #include "libmesh/dense_vector.h"
+#include "libmesh/elem_range.h"
 #include "libmesh/error_estimator.h"
 #include "libmesh/fem_context.h"
+#include "libmesh/threads.h"
 
 // C++ includes
 #include <cstddef>
 #include <string>
 #include <vector>
 #include <memory>
+#include <utility>
 
 namespace libMesh
 {
@@ -124,6 +127,49 @@ protected:
    */
   float coarse_n_flux_faces_increment();
 
+  /**
+   * \returns A new estimator with the same settings as this one, for
+   * use by an additional thread in estimate_error(), or \p nullptr
+   * if this estimator cannot be cloned, in which case
+   * estimate_error() runs on a single thread.
+   *
+   * The default implementation returns \p nullptr; derived classes
+   * with no state other than their settings should override it.
+   */
+  virtual std::unique_ptr<JumpErrorEstimator> clone_for_thread() const;
+
+  /**
+   * Copies the settings of \p other, for use by clone_for_thread()
+   * implementations.
+   */
+  void copy_settings(const JumpErrorEstimator & other);
+
+  /**
+   * Builds and initializes the fine and coarse contexts for \p system.
+   */
+  void init_contexts(const System & system);
+
+#ifdef LIBMESH_ENABLE_AMR
+  /**
+   * \returns The parent of \p e if all of its children are active,
+   * so that an error estimate can be computed on it, or \p nullptr
+   * otherwise.
+   */
+  const Elem * estimable_parent(const Elem & e) const;
+#endif
+
+  /**
+   * Integrates the jumps on the sides of active element \p e, and on
+   * the sides of \p parent if it is not \p nullptr, appending each
+   * (element id, contribution) pair to \p errors and, if we scale by
+   * the number of flux faces, to \p flux_faces.
+   */
+  void integrate_sides(const System & system,
+                       const Elem & e,
+                       const Elem * parent,
+                       std::vector<std::pair<dof_id_type, ErrorVectorReal>> & errors,
+                       std::vector<std::pair<dof_id_type, float>> & flux_faces);
+
   /**
    * An initialization function, to give derived classes a chance to
    * request specific data from the FE objects
@@ -166,6 +212,40 @@ protected:
    * The variable number currently being evaluated
    */
   unsigned int var;
+
+private:
+
+  /**
+   * Class to sum the error contributions of a range of elements into
+   * vectors of its own.  May be executed in parallel on separate
+   * threads, each borrowing one of \p free_estimators for its
+   * contexts, and the results joined afterwards.
+   */
+  class EstimateJumps
+  {
+  public:
+    EstimateJumps (const System & sys,
+                   std::vector<JumpErrorEstimator *> & free_ee,
+                   bool estimate_parent,
+                   std::size_t n_elem,
+                   bool count_flux_faces);
+
+    EstimateJumps (EstimateJumps & other, Threads::split);
+
+    void operator()(const ConstElemRange & range);
+
+    void join (const EstimateJumps & other);
+
+    std::vector<ErrorVectorReal> error_per_cell;
+    std::vector<float> n_flux_faces;
+
+  private:
+    const System & system;
+    std::vector<JumpErrorEstimator *> & free_estimators;
+    const bool estimate_parent_error;
+  };
+
+  friend class EstimateJumps;
 };
 
 
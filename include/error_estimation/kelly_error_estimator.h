@@ -83,6 +83,8 @@ public:
 
   /**
    * Register a user function to use in computing the flux BCs.
+   * The function need not be thread-safe: while one is attached,
+   * errors are estimated on a single thread.
    */
   void attach_flux_bc_function (std::pair<bool,Real> fptr(const System & system,
                                                           const Point & p,
@@ -92,6 +94,12 @@ public:
 
 protected:
 
+  /**
+   * \returns A new estimator with the same settings, for use by
+   * another thread.
+   */
+  virtual std::unique_ptr<JumpErrorEstimator> clone_for_thread() const override;
+
   /**
    * An initialization function, for requesting specific data from the FE
    * objects.
@@ -582,6 +582,23 @@ public:
    */
   friend std::ostream & operator << (std::ostream & os, const FEAbstract & fe);
 
+  /**
+   * Exchanges the values computed by the most recent reinit() with
+   * those held by \p other, which must have been built with the same
+   * dimension and FEType.  Only the contents of the computed vectors
+   * are exchanged, so references previously returned by get_phi(),
+   * get_JxW() etc. stay valid and see the exchanged values; swapping
+   * again restores this object's own values.
+   */
+  virtual void swap_values(FEAbstract & other);
+
+  /**
+   * Copies the values computed by the most recent reinit() on
+   * \p other, which must have been built with the same dimension and
+   * FEType, into this object.
+   */
+  virtual void copy_values(const FEAbstract & other);
+
   /**
    * request phi calculations
    */
@@ -616,6 +633,18 @@ public:
 
 protected:
 
+  /**
+   * FEBatch needs to know whether shape functions can be shared
+   * between the elements of a batch.
+   */
+  friend class FEBatch;
+
+  /**
+   * TensorProductEvaluator only tabulates derivatives, and checks its
+   * tables against ours, when they are being computed.
+   */
+  friend class TensorProductEvaluator;
+
   /**
    * After having updated the jacobian and the transformation
    * from local to global coordinates in \p FEMap::compute_map(),
@@ -537,6 +537,10 @@ public:
 
 #endif
 
+  virtual void swap_values(FEAbstract & other) override;
+
+  virtual void copy_values(const FEAbstract & other) override;
+
 
 protected:
 
@@ -770,6 +774,13 @@ protected:
 
 private:
 
+  /**
+   * Applies \p op to each pair of corresponding computed shape
+   * function vectors of \p a and \p b.
+   */
+  template <typename FEA, typename FEB, typename Op>
+  static void for_each_value(FEA & a, FEB & b, Op op);
+
 #ifdef LIBMESH_ENABLE_INFINITE_ELEMENTS
 
   /**
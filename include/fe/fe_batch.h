@@ -0,0 +1,202 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_BATCH_H
+#define LIBMESH_FE_BATCH_H
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/fe_type.h"
+
+// C++ includes
+#include <memory>
+#include <vector>
+
+namespace libMesh
+{
+
+// forward declarations
+class Elem;
+class QBase;
+template <typename OutputType> class FEGenericBase;
+typedef FEGenericBase<Real> FEBase;
+
+/**
+ * Evaluates scalar-valued finite element data for a whole batch of
+ * elements at once.
+ *
+ * All elements passed to a single reinit() call must share the same
+ * \p ElemType and p refinement level.  When the reference shape
+ * function tables do not depend on the particular element (e.g. for
+ * LAGRANGE, L2_LAGRANGE and MONOMIAL families) and every element uses
+ * a Lagrange mapping, the reference tables are evaluated once and the
+ * mapping and physical gradients are then computed for the whole
+ * batch with unit-stride loops over the element index.  Otherwise we
+ * fall back on one \p FE::reinit() per element, so results are always
+ * the same as those of an \p FEBase object.
+ *
+ * Results are stored in structure-of-arrays form: quadrature point
+ * data for point \p qp on batch element \p e is found at index
+ * \p qp_index(qp,e), and shape function data for shape function \p i
+ * at index \p shape_index(i,qp,e).
+ *
+ * \brief Batched evaluation of finite element data.
+ */
+class FEBatch
+{
+public:
+
+  /**
+   * Constructor.  The quadrature rule \p qrule is used for every
+   * element in the batch and must outlive this object.
+   */
+  FEBatch (const unsigned int dim,
+           const FEType & fe_type,
+           QBase & qrule);
+
+  ~FEBatch ();
+
+  /**
+   * Computes the mapping and shape function data for every element
+   * in \p elems.
+   */
+  void reinit (const std::vector<const Elem *> & elems);
+
+  /**
+   * \returns The number of elements in the current batch.
+   */
+  unsigned int n_elem () const { return _n_elem; }
+
+  /**
+   * \returns The number of quadrature points per element.
+   */
+  unsigned int n_qp () const { return _n_qp; }
+
+  /**
+   * \returns The number of shape functions per element.
+   */
+  unsigned int n_shape_functions () const { return _n_shape_functions; }
+
+  /**
+   * \returns \p true if the most recent reinit() used the batched
+   * code path rather than falling back to per-element reinits.
+   */
+  bool used_batched_path () const { return _batched; }
+
+  /**
+   * \returns The storage index of quadrature point \p qp on batch
+   * element \p e.
+   */
+  std::size_t qp_index (unsigned int qp, unsigned int e) const
+  { return std::size_t(qp) * _n_elem + e; }
+
+  /**
+   * \returns The storage index of shape function \p i at quadrature
+   * point \p qp on batch element \p e.
+   */
+  std::size_t shape_index (unsigned int i, unsigned int qp, unsigned int e) const
+  { return (std::size_t(i) * _n_qp + qp) * _n_elem + e; }
+
+  /**
+   * \returns The physical coordinates of the quadrature points.
+   */
+  const std::vector<Real> & get_x () const { return _x; }
+  const std::vector<Real> & get_y () const { return _y; }
+  const std::vector<Real> & get_z () const { return _z; }
+
+  /**
+   * \returns The element Jacobian times the quadrature weight.
+   */
+  const std::vector<Real> & get_JxW () const { return _JxW; }
+
+  /**
+   * \returns The shape function values.
+   */
+  const std::vector<Real> & get_phi () const { return _phi; }
+
+  /**
+   * \returns The components of the physical shape function gradients.
+   */
+  const std::vector<Real> & get_dphidx () const { return _dphidx; }
+  const std::vector<Real> & get_dphidy () const { return _dphidy; }
+  const std::vector<Real> & get_dphidz () const { return _dphidz; }
+
+private:
+
+  /**
+   * \returns \p true if \p elems can be handled by the batched code path.
+   */
+  bool can_batch (const std::vector<const Elem *> & elems) const;
+
+  /**
+   * Resizes all result arrays for the current batch dimensions.
+   */
+  void resize_arrays ();
+
+  /**
+   * Per-element fallback: reinit \p _fe on each element in turn and
+   * scatter its results into our arrays.
+   */
+  void reinit_elementwise (const std::vector<const Elem *> & elems);
+
+  /**
+   * The batched code path.
+   */
+  void reinit_batched (const std::vector<const Elem *> & elems);
+
+  const unsigned int _dim;
+
+  QBase & _qrule;
+
+  /**
+   * The finite element object used for reference-element evaluations
+   * and for the per-element fallback.
+   */
+  std::unique_ptr<FEBase> _fe;
+
+  unsigned int _n_elem;
+  unsigned int _n_qp;
+  unsigned int _n_shape_functions;
+  bool _batched;
+
+  /**
+   * Results, in structure-of-arrays form.
+   */
+  std::vector<Real> _x, _y, _z;
+  std::vector<Real> _JxW;
+  std::vector<Real> _phi;
+  std::vector<Real> _dphidx, _dphidy, _dphidz;
+
+  /**
+   * Work arrays for the batched path: nodal coordinates indexed by
+   * (node, elem), and the mapping derivatives and inverse mapping
+   * derivatives indexed by (qp, elem).
+   */
+  std::vector<Real> _node_x, _node_y, _node_z;
+  std::vector<Real> _dxdxi, _dydxi, _dzdxi;
+  std::vector<Real> _dxdeta, _dydeta, _dzdeta;
+  std::vector<Real> _dxdzeta, _dydzeta, _dzdzeta;
+  std::vector<Real> _dxidx, _dxidy, _dxidz;
+  std::vector<Real> _detadx, _detady, _detadz;
+  std::vector<Real> _dzetadx, _dzetady, _dzetadz;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_BATCH_H
@@ -640,6 +640,49 @@ public:
    */
   void set_jacobian_tolerance(Real tol) { jacobian_tolerance = tol; }
 
+  /**
+   * Enables or disables single point storage of affine maps.  When
+   * enabled, reinitializing on an element with an affine map stores
+   * the mapping derivatives, inverse map derivatives and Jacobian
+   * (which are constant on such an element) only once rather than
+   * once per quadrature point.  \p get_xyz() and \p get_JxW() are
+   * still filled at every quadrature point.
+   *
+   * Code reading the other per-point vectors directly must then index
+   * them with \p map_index().  Disabled by default.
+   */
+  void set_single_point_affine_map(bool single_point)
+  { _single_point_affine_map = single_point; }
+
+  /**
+   * \returns \p true if the most recent map computation stored the
+   * mapping derivatives and Jacobian at a single point only.
+   */
+  bool has_single_point_map() const
+  { return _has_single_point_map; }
+
+  /**
+   * \returns The index at which the mapping derivatives and Jacobian
+   * for quadrature point \p p are stored: \p p itself normally, or 0
+   * if \p has_single_point_map().
+   */
+  unsigned int map_index(unsigned int p) const
+  { return _has_single_point_map ? 0 : p; }
+
+  /**
+   * Exchanges the physical map data computed by the most recent
+   * compute_map() with that held by \p other.  Only the contents of
+   * the vectors are exchanged, so references previously returned by
+   * get_xyz(), get_JxW() etc. stay valid.
+   */
+  void swap_values(FEMap & other);
+
+  /**
+   * Copies the physical map data computed by the most recent
+   * compute_map() on \p other into this object.
+   */
+  void copy_values(const FEMap & other);
+
 protected:
 
   /**
@@ -1031,7 +1074,25 @@ protected:
    */
   Real jacobian_tolerance;
 
+  /**
+   * Whether compute_affine_map() should store constant map data at
+   * a single point.
+   */
+  bool _single_point_affine_map;
+
+  /**
+   * Whether the current map data is stored at a single point.
+   */
+  bool _has_single_point_map;
+
 private:
+  /**
+   * Applies \p op to each pair of corresponding physical map data
+   * vectors of \p a and \p b.
+   */
+  template <typename MapA, typename MapB, typename Op>
+  static void for_each_value(MapA & a, MapB & b, Op op);
+
   /**
    * A helper function used by FEMap::compute_single_point_map() to
    * compute second derivatives of the inverse map.
@@ -0,0 +1,181 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_SHAPE_CACHE_H
+#define LIBMESH_FE_SHAPE_CACHE_H
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/fe_type.h"
+#include "libmesh/point.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/enum_quadrature_type.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <atomic>
+#include <deque>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * A process-wide cache of reference element shape function derivative
+ * tabulations, shared by every \p FE object on every thread.
+ *
+ * For families whose shape functions do not depend on the particular
+ * element (i.e. \p FEAbstract::shapes_need_reinit() is false), the
+ * reference derivatives evaluated in \p FE::init_shape_functions()
+ * depend only on the \p FEType, the \p ElemType, the p refinement
+ * level and the quadrature points.  Those tables are computed once per
+ * key and copied out of the cache afterwards, rather than being
+ * re-evaluated every time an \p FE object switches element types or p
+ * levels.
+ *
+ * Cached tables are immutable once inserted, so lookups only need to
+ * hold the cache lock while searching the map.  Each entry also keeps
+ * the points it was evaluated at, and a lookup only succeeds if those
+ * match the requested points exactly, so user-modified quadrature
+ * rules can never be served stale data.
+ *
+ * The cache holds at most \p max_size() entries; inserting beyond
+ * that evicts the oldest entries first.
+ *
+ * \brief Thread-safe cache of reference shape function tabulations.
+ */
+class FEShapeCache
+{
+public:
+
+  /**
+   * Everything, other than the points themselves, which the reference
+   * tables depend on.
+   */
+  struct Key
+  {
+    FEType fe_type;
+    ElemType elem_type;
+    unsigned int p_level;
+    bool add_p_level;
+    QuadratureType q_type;
+    Order q_order;
+    unsigned int n_points;
+
+    bool operator< (const Key & other) const
+    {
+      return std::tie(fe_type, elem_type, p_level, add_p_level, q_type, q_order, n_points) <
+        std::tie(other.fe_type, other.elem_type, other.p_level, other.add_p_level,
+                 other.q_type, other.q_order, other.n_points);
+    }
+  };
+
+  /**
+   * The cached tabulations, indexed [shape function][point] like the
+   * corresponding \p FEGenericBase members.
+   */
+  struct Tables
+  {
+    std::vector<Point> points;
+
+    std::vector<std::vector<Real>> dphidxi, dphideta, dphidzeta;
+
+    /**
+     * Whether the second derivative tables below were filled in.
+     */
+    bool has_second_derivatives = false;
+
+#ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
+    std::vector<std::vector<Real>> d2phidxi2, d2phidxideta, d2phideta2,
+      d2phidxidzeta, d2phidetadzeta, d2phidzeta2;
+#endif
+  };
+
+  /**
+   * \returns The tables stored for \p key, or a null pointer if there
+   * are none, if they were evaluated at points other than \p points,
+   * or if \p need_second_derivatives is true and they lack second
+   * derivatives.
+   */
+  static std::shared_ptr<const Tables> find (const Key & key,
+                                             const std::vector<Point> & points,
+                                             bool need_second_derivatives);
+
+  /**
+   * Stores \p tables for \p key, replacing any existing entry.  If
+   * the cache is full, the oldest entry is evicted.
+   */
+  static void insert (const Key & key,
+                      std::shared_ptr<const Tables> tables);
+
+  /**
+   * Removes every cached entry.  Tables still held by callers remain
+   * valid.
+   */
+  static void clear ();
+
+  /**
+   * \returns The number of cached entries.
+   */
+  static std::size_t size ();
+
+  /**
+   * Sets the largest number of entries the cache may hold, evicting
+   * the oldest entries if it currently holds more.  Zero entries
+   * disables caching in effect.
+   */
+  static void set_max_size (std::size_t max_size);
+
+  /**
+   * \returns The largest number of entries the cache may hold.
+   */
+  static std::size_t max_size ();
+
+  /**
+   * Turns caching on or off.  Caching is on by default.  FE objects
+   * reinitializing on other threads see the change from their next
+   * reinit() on.
+   */
+  static void enable (bool enabled);
+
+  /**
+   * \returns Whether caching is on.
+   */
+  static bool enabled ();
+
+private:
+
+  /**
+   * The cached entries, and their keys in the order they were
+   * inserted.  Both are guarded by \p _mutex.
+   */
+  static std::map<Key, std::shared_ptr<const Tables>> _tables;
+  static std::deque<Key> _insertion_order;
+  static std::size_t _max_size;
+  static Threads::spin_mutex _mutex;
+
+  static std::atomic<bool> _enabled;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_SHAPE_CACHE_H
@@ -0,0 +1,181 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_TENSOR_PRODUCT_EVALUATOR_H
+#define LIBMESH_TENSOR_PRODUCT_EVALUATOR_H
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/fe_type.h"
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/vector_value.h"
+
+// C++ includes
+#include <array>
+#include <vector>
+
+namespace libMesh
+{
+
+// forward declarations
+class QBase;
+template <typename T> class DenseSubVector;
+template <typename OutputType> class FEGenericBase;
+typedef FEGenericBase<Real> FEBase;
+
+/**
+ * Evaluates finite element solutions at every quadrature point of an
+ * element at once, using sum factorization whenever the element's
+ * shape functions are tensor products of one dimensional functions
+ * and the quadrature rule is a tensor product rule.
+ *
+ * The one dimensional tables are built directly from the one
+ * dimensional shape functions of the same family, evaluated at the
+ * one dimensional points of the quadrature rule, and each shape
+ * function is matched with the product of one dimensional functions
+ * its node sits at.  This currently handles the nodal LAGRANGE and
+ * L2_LAGRANGE families, of first or second order, on quadrilaterals
+ * and hexahedra whose nodes form a tensor product grid (e.g. QUAD4,
+ * QUAD9, HEX8, HEX27, and the vertices of QUAD8 and HEX20 at first
+ * order).  Other families, elements which do not factor (simplices,
+ * serendipity elements, ...) and non tensor product quadrature rules
+ * leave the evaluator invalid, and callers should fall back on the
+ * usual dense loops.
+ *
+ * With p+1 one dimensional functions and quadrature points per
+ * direction, evaluating values or reference gradients costs
+ * O(p^{d+1}) instead of O(p^{2d}).
+ *
+ * \brief Sum factorized evaluation of tensor product elements.
+ */
+class TensorProductEvaluator
+{
+public:
+
+  TensorProductEvaluator ();
+
+  /**
+   * Sets up evaluation on the element \p fe has just been
+   * reinitialized on, at the points of \p qrule.  The one dimensional
+   * tables from a previous call are reused if the FE type, element
+   * type, p level and points are unchanged.
+   *
+   * \returns valid().
+   */
+  bool reinit (const FEBase & fe,
+               const QBase & qrule);
+
+  /**
+   * \returns \p true if the last reinit() succeeded.
+   */
+  bool valid () const { return _valid; }
+
+  /**
+   * \returns \p true if \p fe was computing reference derivatives
+   * (and so the inverse map evaluate_gradients() needs) too.
+   */
+  bool has_gradients () const { return _valid && _has_gradients; }
+
+  /**
+   * Computes \p u at every quadrature point from the shape function
+   * coefficients \p coef.
+   */
+  void evaluate_values (const DenseSubVector<Number> & coef,
+                        std::vector<Number> & u) const;
+
+  /**
+   * Computes the physical gradient \p du at every quadrature point
+   * from the shape function coefficients \p coef, using the current
+   * mapping of \p fe.
+   */
+  void evaluate_gradients (const FEBase & fe,
+                           const DenseSubVector<Number> & coef,
+                           std::vector<Gradient> & du) const;
+
+private:
+
+  /**
+   * Builds the one dimensional tables and the shape function to
+   * coefficient tensor mapping for \p fe and \p qrule from scratch.
+   */
+  bool build_tables (const FEBase & fe,
+                     const QBase & qrule);
+
+#ifdef DEBUG
+  /**
+   * Checks the products of our one dimensional tables against any
+   * shape function and reference derivative tables \p fe has
+   * computed itself.
+   */
+  void check_tables (const FEBase & fe) const;
+#endif
+
+  /**
+   * Contracts the coefficient tensor with the given one dimensional
+   * table in each direction, writing values at every quadrature
+   * point into \p u.
+   */
+  void contract (const std::array<const std::vector<Real> *, 3> & tables,
+                 std::vector<Number> & u) const;
+
+  bool _valid;
+
+  bool _has_gradients;
+
+  /**
+   * The key for reusing tables.
+   */
+  FEType _fe_type;
+  ElemType _elem_type;
+  unsigned int _p_level;
+  std::vector<Real> _points_1d;
+
+  unsigned int _dim;
+
+  /**
+   * The number of quadrature points in each direction.
+   */
+  unsigned int _n_1d;
+
+  /**
+   * The number of one dimensional functions in each direction.
+   */
+  std::array<unsigned int, 3> _n_basis;
+
+  /**
+   * One dimensional function values and derivatives, indexed
+   * [direction][function*_n_1d + point].
+   */
+  std::array<std::vector<Real>, 3> _basis, _deriv;
+
+  /**
+   * For each shape function, its position in the coefficient tensor.
+   */
+  std::vector<unsigned int> _shape_offset;
+
+  /**
+   * Work space for contractions.
+   */
+  mutable std::vector<Number> _coefs, _work_a, _work_b;
+  mutable std::array<std::vector<Number>, 3> _dref;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_TENSOR_PRODUCT_EVALUATOR_H
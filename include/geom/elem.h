@@ -26,6 +26,7 @@
 #include "libmesh/dof_object.h"
 #include "libmesh/id_types.h"
 #include "libmesh/reference_counted_object.h"
+#include "libmesh/object_pool.h"
 #include "libmesh/node.h"
 #include "libmesh/enum_elem_type.h" // INVALID_ELEM
 #include "libmesh/multi_predicates.h"
@@ -129,6 +130,18 @@ public:
    */
   virtual ~Elem() = default;
 
+  /**
+   * Elements are allocated from an ObjectPool, for the same reasons
+   * as Node.  Elements of one type share a size class.  Deleting an
+   * element through an \p Elem pointer passes the size of its actual
+   * type, since our destructor is virtual.
+   */
+  static void * operator new (std::size_t size)
+  { return ObjectPool::allocate(size); }
+
+  static void operator delete (void * p, std::size_t size)
+  { ObjectPool::deallocate(p, size); }
+
   /**
    * \returns The \p Point associated with local \p Node \p i.
    */
@@ -24,6 +24,7 @@
 #include "libmesh/point.h"
 #include "libmesh/dof_object.h"
 #include "libmesh/reference_counted_object.h"
+#include "libmesh/object_pool.h"
 
 // C++ includes
 #include <iostream>
@@ -100,6 +101,18 @@ public:
    */
   ~Node ();
 
+  /**
+   * Nodes are allocated from an ObjectPool, so that those built
+   * together are stored together and so that building and deleting
+   * large meshes does not go through the system allocator once per
+   * node.
+   */
+  static void * operator new (std::size_t size)
+  { return ObjectPool::allocate(size); }
+
+  static void operator delete (void * p, std::size_t size)
+  { ObjectPool::deallocate(p, size); }
+
   /**
    * Assign to a node from a point.
    */
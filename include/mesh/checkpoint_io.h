@@ -27,8 +27,13 @@
 #include "libmesh/mesh_output.h"
 #include "libmesh/mesh_communication.h"
 #include "libmesh/parallel_object.h"
+#include "libmesh/threads.h"
 
 // C++ includes
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -114,9 +119,21 @@ public:
    *     cp->write("foo.cpr");
    *
    * would create a directory named "foo.cpr-split42".
+   *
+   * If asynchronous() is set, this only creates the directory and
+   * takes a copy of the mesh before returning; the files are then
+   * written from that copy by a background thread.  Any checkpoint
+   * still being written is waited for first.
    */
   virtual void write (const std::string & name) override;
 
+  /**
+   * Blocks until the files of any asynchronous write() are complete,
+   * and frees the mesh copy they were written from.  Any error which
+   * occurred while writing them is rethrown here.
+   */
+  void wait_for_checkpoint ();
+
   /**
    * Used to remove a checkpoint directory and its corresponding files.  This effectively undoes
    * all the work done be calls to write(...).  For example, if a checkpoint configuration was
@@ -137,6 +154,10 @@ public:
    *     CheckpointIO::cleanup(your_mesh, your_mesh.comm().size());
    *
    * Other remaining checkpoint split configurations for the mesh are left unmodified.
+   *
+   * The mesh files of a checkpoint which incremental checkpoints
+   * still refer to are kept until the last of those has been cleaned
+   * up too, so checkpoints may be cleaned up in any order.
    */
   static void cleanup(const std::string & input_name, processor_id_type n_procs);
 
@@ -152,6 +173,43 @@ public:
   bool   parallel() const { return _parallel; }
   bool & parallel()       { return _parallel; }
 
+  /**
+   * Get/Set the flag indicating if write() should return before the
+   * files are written, leaving them to a background thread.  This
+   * costs a copy of the mesh per checkpoint in flight, and
+   * wait_for_checkpoint() must be called to find out whether the
+   * write succeeded.  Without thread support, writes are synchronous
+   * regardless.
+   */
+  bool   asynchronous() const { return _asynchronous; }
+  bool & asynchronous()       { return _asynchronous; }
+
+  /**
+   * Get/Set the flag indicating if write() should skip writing the
+   * mesh files when the mesh is unchanged since this object last
+   * wrote it in full, with the same settings.  This is off by
+   * default.
+   *
+   * The mesh counts as unchanged if its MeshBase::generation() and a
+   * checksum of its node coordinates are both the same as at the full
+   * write.  Anything else about the mesh which code changes in place,
+   * without going through the MeshBase, BoundaryInfo or
+   * MeshTools::Modification functions which bump the generation,
+   * e.g. element subdomain ids or extra integers, must be followed by
+   * a call to MeshBase::increment_generation(), or else the
+   * incremental checkpoint refers to stale mesh files.
+   *
+   * The header of an incremental checkpoint refers to the mesh files
+   * of the full one, by the name that checkpoint was written under,
+   * so the full checkpoint must not be moved while incremental ones
+   * are still needed.  read() follows the reference automatically,
+   * and cleanup() keeps the mesh files of a full checkpoint until
+   * nothing refers to them.  Once a full checkpoint has been cleaned
+   * up, the next checkpoint is written in full again.
+   */
+  bool   incremental() const { return _incremental; }
+  bool & incremental()       { return _incremental; }
+
   /**
    * Get/Set the version string.
    */
@@ -167,6 +225,16 @@ public:
    */
   bool version_at_least_1_5() const;
 
+  /**
+   * \returns \p true if the current file has an XDR/XDA version that
+   * matches or exceeds 1.6
+   *
+   * As of this version we record the mesh generation, and the header
+   * of an incremental checkpoint names the checkpoint whose mesh
+   * files it shares.
+   */
+  bool version_at_least_1_6() const;
+
   /**
    * Get/Set the processor id or processor ids to use.
    *
@@ -197,6 +265,13 @@ private:
   //---------------------------------------------------------------------------
   // Write Implementation
 
+  /**
+   * Write the header and split files for a checkpoint whose
+   * directory already exists.  This does no communication or
+   * logging, so it is safe to run from a background thread.
+   */
+  void write_files (const std::string & name) const;
+
   /**
    * Write subdomain name information
    */
@@ -327,13 +402,41 @@ private:
 
   bool _binary;
   bool _parallel;
+  bool _asynchronous;
+  bool _incremental;
   std::string _version;
 
+  // The checkpoint whose mesh files the one being written or read
+  // refers to, or empty if it has its own
+  std::string _mesh_source;
+
+  // The last checkpoint we wrote in full, and the mesh generation,
+  // coordinate checksum and settings it was written with
+  struct FullCheckpoint
+  {
+    std::string name;
+    std::size_t mesh_generation;
+    std::uint64_t coordinate_checksum;
+    bool binary;
+    bool parallel;
+    processor_id_type n_processors;
+    std::vector<processor_id_type> processor_ids;
+  };
+  std::optional<FullCheckpoint> _last_full;
+
   // The processor ids to write
   std::vector<processor_id_type> _my_processor_ids;
 
   // The largest processor id to write
   processor_id_type _my_n_processors;
+
+  // For an asynchronous write in progress: the copy of the mesh being
+  // written, a writer for that copy, the thread doing the writing,
+  // and any error it has run into.
+  std::unique_ptr<MeshBase> _staged_mesh;
+  std::unique_ptr<CheckpointIO> _staged_writer;
+  std::unique_ptr<Threads::Thread> _write_thread;
+  std::exception_ptr _write_error;
 };
 
 
@@ -572,6 +572,21 @@ public:
    */
   void set_hdf5_writing(bool write_hdf5);
 
+  /**
+   * Set to true (false is the default) to have write_timestep() write
+   * nodal solution values from every processor at once, each
+   * processor writing the values at its own nodes directly into the
+   * single output file, instead of gathering them all on processor 0.
+   * The mesh itself is still written by processor 0, once, when the
+   * file is created, and a distributed mesh is serialized onto
+   * processor 0 to do so; only the nodal data written every timestep
+   * avoids that.  The mesh must be contiguously numbered.
+   *
+   * This requires HDF5 writing and an Exodus library built on a
+   * parallel NetCDF-4/HDF5; it is an error to enable it otherwise.
+   */
+  void set_parallel_writing(bool write_in_parallel);
+
   /**
    * Set to true (false is the default) to generate independent nodes
    * for every Bezier Extraction element in an input file containing
@@ -616,6 +631,20 @@ private:
    * rather than created from scratch when writing.
    */
   bool _append;
+
+  /**
+   * Default false.  If true, write_timestep() writes nodal data from
+   * every processor at once.  See set_parallel_writing().
+   */
+  bool _write_in_parallel;
+
+  /**
+   * The write_timestep() implementation for parallel writing.
+   */
+  void write_timestep_in_parallel (const std::string & fname,
+                                   const EquationSystems & es,
+                                   const Real time,
+                                   const std::set<std::string> * system_names);
 #endif
 
   /**
@@ -507,6 +507,41 @@ public:
    */
   void write_nodal_values(int var_id, const std::vector<Real> & values, int timestep);
 
+  /**
+   * \returns \p true if this build of Exodus can write to one file
+   * from every processor at once, which needs MPI and a NetCDF-4
+   * built on parallel HDF5.
+   */
+  static bool can_write_in_parallel();
+
+  /**
+   * Closes the file processor 0 has been writing and reopens it on
+   * every processor, so that each can write its own slab of the
+   * transient data directly.  The file must have been created with
+   * HDF5 writing enabled, and can_write_in_parallel() must be true.
+   * Must be called on all processors.
+   */
+  void open_parallel();
+
+  /**
+   * Closes a file reopened by open_parallel() on every processor, and
+   * reopens it for writing from processor 0 alone again.  Must be
+   * called on all processors.
+   */
+  void close_parallel();
+
+  /**
+   * Writes \p values to a nodal variable at the \p values.size()
+   * consecutive nodes starting with the zero-based Exodus node
+   * \p first_node.  While the file is open_parallel() this is
+   * collective, and each processor passes its own range of nodes,
+   * which may be empty.
+   */
+  void write_partial_nodal_values(int var_id,
+                                  dof_id_type first_node,
+                                  const std::vector<Real> & values,
+                                  int timestep);
+
   /**
    * Writes the vector of information records.
    */
@@ -942,6 +977,10 @@ protected:
   // This flag gets set after the create() function has been successfully called.
   bool _opened_by_create;
 
+  // True while every processor has the file open, between
+  // open_parallel() and close_parallel()
+  bool _opened_in_parallel;
+
   // True once the elem vars are initialized
   bool _elem_vars_initialized;
 
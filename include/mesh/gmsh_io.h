@@ -82,6 +82,29 @@ public:
    */
   virtual void read (const std::string & name) override;
 
+  /**
+   * Reads in a mesh in the Gmsh *.msh format, on every processor at
+   * once.
+   *
+   * For binary files of version 4.1 or later, each processor reads
+   * only its own share of the $Nodes and $Elements sections, then
+   * the pieces are exchanged so that each processor ends up with a
+   * contiguous range of elements, their nodes, and the boundary
+   * information the lower-dimensional elements provide.  No processor
+   * ever holds the whole mesh unless the mesh is replicated.  Node
+   * ids are the Gmsh node tags, less the smallest tag, rather than
+   * the file order read() numbers nodes in.  NameBasedIO only uses
+   * this for distributed meshes, so that replicated meshes keep their
+   * old numbering.
+   *
+   * Other files are read by read() on processor 0 and broadcast.
+   *
+   * \note The user is responsible for calling Mesh::prepare_for_use()
+   * after reading the mesh and before using it; that also partitions
+   * and redistributes the pieces properly.
+   */
+  void read_parallel (const std::string & name);
+
   /**
    * This method implements writing a mesh to a specified file
    * in the Gmsh *.msh format.
@@ -128,6 +151,12 @@ private:
    */
   void read_mesh (std::istream & in);
 
+  /**
+   * Implementation of read_parallel() for binary files, from just
+   * after the byte order check in the $MeshFormat section.
+   */
+  void read_binary_parallel (std::istream & in);
+
   /**
    * This method implements writing a mesh to a
    * specified file.  This will write an ASCII *.msh file.
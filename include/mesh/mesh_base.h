@@ -35,6 +35,7 @@
 #include <cstddef>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace libMesh
 {
@@ -46,6 +47,7 @@ class Node;
 class Point;
 class Partitioner;
 class BoundaryInfo;
+struct SidePair;
 
 template <typename T>
 class SparseMatrix;
@@ -197,7 +199,26 @@ public:
    * Tells this we have done some operation where we should no longer consider ourself prepared
    */
   void set_isnt_prepared()
-  { _is_prepared = false; }
+  { _is_prepared = false; ++_generation; }
+
+  /**
+   * \returns A counter which is incremented whenever the mesh is
+   * cleared, partitioned, prepared for use or marked as unprepared,
+   * and by the BoundaryInfo and MeshTools::Modification functions
+   * which change the mesh in place, i.e. after any change to its
+   * elements, nodes, boundary ids or partitioning made through the
+   * usual interfaces.  Code which modifies nodes or elements directly,
+   * e.g. by moving nodes, should call increment_generation() itself
+   * if anyone (such as an incremental \p CheckpointIO) relies on this.
+   */
+  std::size_t generation () const
+  { return _generation; }
+
+  /**
+   * Marks the mesh as changed, without any other side effects.
+   */
+  void increment_generation ()
+  { ++_generation; }
 
   /**
    * \returns \p true if all elements and nodes of the mesh
@@ -1205,6 +1226,44 @@ public:
   void allow_remote_element_removal(bool allow) { _allow_remote_element_removal = allow; }
   bool allow_remote_element_removal() const { return _allow_remote_element_removal; }
 
+  /**
+   * If true is passed in then every DofMap::distribute_dofs() on this
+   * mesh finishes by calling pack_dof_object_indexing().  This is
+   * false by default.
+   */
+  void contiguous_dof_object_indexing(bool contiguous) { _contiguous_dof_object_indexing = contiguous; }
+  bool contiguous_dof_object_indexing() const { return _contiguous_dof_object_indexing; }
+
+  /**
+   * If true is passed in then renumber_nodes_and_elements() gives
+   * elements and nodes ids in the order of a Hilbert space-filling
+   * curve through them, rather than keeping their existing relative
+   * order.  Elements are ordered by refinement level first, so
+   * parents still precede their children.  On a DistributedMesh ids
+   * remain contiguous by processor and only each processor's own
+   * block is reordered.
+   *
+   * DofMap::distribute_dofs() numbers degrees of freedom in element
+   * order, so this gives more banded sparsity patterns and better
+   * memory locality during assembly.  This is false by default, and
+   * has no effect if renumbering is not allowed or if libMesh was
+   * built without libHilbert and MPI.
+   */
+  void renumber_for_locality(bool locality) { _renumber_for_locality = locality; }
+  bool renumber_for_locality() const { return _renumber_for_locality; }
+
+  /**
+   * Gathers the DoF index buffers of every node and element into a
+   * single array owned by the mesh, ordered by node id and then by
+   * element id, in place of one heap allocation per object.  This
+   * saves memory and improves locality in e.g. DofMap::dof_indices().
+   *
+   * Objects whose buffers later change size (from a DofMap reinit,
+   * new extra integers, etc.) move back to heap storage of their own;
+   * calling this again repacks everything and frees the old array.
+   */
+  void pack_dof_object_indexing();
+
   /**
    * If true is passed in then the elements on this mesh will no
    * longer be (re)partitioned, and the nodes on this mesh will only
@@ -1487,6 +1546,20 @@ public:
    */
   void clear_point_locator ();
 
+  /**
+   * \returns Every side owned by an active local element, as found by
+   * \p MeshTools::find_side_pairs().  The list is built when first
+   * needed and rebuilt the first time it is needed after the mesh
+   * generation() changes.  This should not be used in threaded code
+   * unless the list is known to be up to date.
+   */
+  const std::vector<SidePair> & side_pairs () const;
+
+  /**
+   * Releases the current list of side pairs.
+   */
+  void clear_side_pairs ();
+
   /**
    * In the point locator, do we count lower dimensional elements
    * when we refine point locator regions? This is relevant in
@@ -1819,6 +1892,15 @@ protected:
    */
   bool nodes_and_elements_equal(const MeshBase & other_mesh) const;
 
+  /**
+   * Sorts \p elems or \p nodes into the order in which
+   * renumber_nodes_and_elements() should number them when
+   * renumber_for_locality() is set.  The result depends only on the
+   * objects passed in, not on which processor sorts them.
+   */
+  void sort_for_locality (std::vector<Elem *> & elems) const;
+  void sort_for_locality (std::vector<Node *> & nodes) const;
+
   /**
    * \returns A writable reference to the number of partitions.
    */
@@ -1855,6 +1937,11 @@ protected:
    */
   bool _is_prepared;
 
+  /**
+   * The count of changes to this mesh; see generation().
+   */
+  std::size_t _generation;
+
   /**
    * A \p PointLocator class for this mesh.
    * This will not actually be built unless needed. Further, since we want
@@ -1870,6 +1957,13 @@ protected:
    */
   bool _count_lower_dim_elems_in_point_locator;
 
+  /**
+   * The list of side pairs, built by side_pairs() when needed, and
+   * the generation() of the mesh it was built for.
+   */
+  mutable std::unique_ptr<std::vector<SidePair>> _side_pairs;
+  mutable std::size_t _side_pairs_generation;
+
   /**
    * A partitioner to use at each prepare_for_use().
    *
@@ -1916,6 +2010,23 @@ protected:
    */
   bool _allow_remote_element_removal;
 
+  /**
+   * If this is true then DoF indexing will be packed into
+   * _dof_object_indexing after each DoF distribution.
+   */
+  bool _contiguous_dof_object_indexing;
+
+  /**
+   * Contiguous storage for the index buffers of our nodes and
+   * elements, built by pack_dof_object_indexing().
+   */
+  std::vector<dof_id_type> _dof_object_indexing;
+
+  /**
+   * If this is true then renumbering follows a space-filling curve.
+   */
+  bool _renumber_for_locality;
+
   /**
    * This structure maintains the mapping of named blocks
    * for file formats that support named blocks.  Currently
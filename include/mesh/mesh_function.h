@@ -276,6 +276,49 @@ public:
                 std::vector<Tensor> & output,
                 const std::set<subdomain_id_type> * subdomain_ids);
 
+  /**
+   * Computes values at each of \p points and for time \p time,
+   * optionally restricting the points to the MeshFunction
+   * subdomain_ids, and stores them in the corresponding entries of
+   * \p output.  The results are those of the single point
+   * operator(), but the points are located all at once and grouped by
+   * element, so that each element's shape functions are evaluated
+   * for all of its points together, in parallel over elements.
+   */
+  void operator() (const std::vector<Point> & points,
+                   const Real time,
+                   std::vector<DenseVector<Number>> & output);
+
+  /**
+   * Computes values at each of \p points and for time \p time,
+   * restricting the points to the passed subdomain_ids, which
+   * parameter overrides the internal subdomain_ids.
+   */
+  void operator() (const std::vector<Point> & points,
+                   const Real time,
+                   std::vector<DenseVector<Number>> & output,
+                   const std::set<subdomain_id_type> * subdomain_ids);
+
+  /**
+   * Computes gradients at each of \p points and for time \p time,
+   * optionally restricting the points to the MeshFunction
+   * subdomain_ids, as the multiple point operator() does for values.
+   * Points which are not found get empty gradient vectors.
+   */
+  void gradient (const std::vector<Point> & points,
+                 const Real time,
+                 std::vector<std::vector<Gradient>> & output);
+
+  /**
+   * Computes gradients at each of \p points and for time \p time,
+   * restricting the points to the passed subdomain_ids, which
+   * parameter overrides the internal subdomain_ids.
+   */
+  void gradient (const std::vector<Point> & points,
+                 const Real time,
+                 std::vector<std::vector<Gradient>> & output,
+                 const std::set<subdomain_id_type> * subdomain_ids);
+
   /**
    * \returns The current \p PointLocator object, for use elsewhere.
    *
@@ -353,6 +396,17 @@ protected:
   std::set<const Elem *> find_elements(const Point & p,
                                        const std::set<subdomain_id_type> * subdomain_ids = nullptr) const;
 
+  /**
+   * Locates all of \p points at once and groups them by the evaluable
+   * element containing them, as find_element() would find them one at
+   * a time.  \p elem_points[e] holds the indices of the points in
+   * \p elems[e]; points in no such element are left out.
+   */
+  void group_points_by_elem (const std::vector<Point> & points,
+                             const std::set<subdomain_id_type> * subdomain_ids,
+                             std::vector<const Elem *> & elems,
+                             std::vector<std::vector<std::size_t>> & elem_points) const;
+
   /**
    * Helper function that is called by MeshFunction::find_element()
    * and MeshFunction::find_elements() to ensure that Elems found by
@@ -361,6 +415,14 @@ protected:
    */
   const Elem * check_found_elem(const Elem * element, const Point & p) const;
 
+  /**
+   * Helper function for finding values as evaluated from a specific
+   * element
+   */
+  void _value_on_elem (const Point & p,
+                       const Elem * element,
+                       DenseVector<Number> & output);
+
   /**
    * Helper function for finding a gradient as evaluated from a
    * specific element
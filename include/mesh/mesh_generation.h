@@ -65,6 +65,15 @@ class QueryElemSubdomainIDBase;
  *
  * Boundary ids are set to be equal to the side indexing on a
  * master hex
+ *
+ * A distributed mesh of EDGE2, EDGE3, QUAD4, QUAD9, HEX8 or HEX27
+ * elements is built in place: each processor creates only a
+ * contiguous range of the elements, and their ghost neighbors are
+ * gathered afterward.  Element, node and unique ids are those a
+ * serial build into a new ReplicatedMesh would give them: nodes
+ * first, then elements.  A distributed mesh which does not allow
+ * remote element removal is built serially, so that it stays
+ * serialized.
  */
 void build_cube (UnstructuredMesh & mesh,
                  const unsigned int nx=0,
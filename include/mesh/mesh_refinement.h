@@ -31,8 +31,10 @@
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
 #include "libmesh/topology_map.h"
 #include "libmesh/parallel_object.h"
+#include "libmesh/point.h"
 
 // C++ Includes
+#include <utility>
 #include <vector>
 
 namespace libMesh
@@ -725,6 +727,49 @@ private:
    */
   void update_nodes_map ();
 
+  /**
+   * Where node n of child c of a parent element comes from, as
+   * computed ahead of time by precompute_child_nodes().
+   */
+  struct PrecomputedChildNode
+  {
+    /**
+     * The parent node this is, or \p invalid_uint for a new node.
+     */
+    unsigned int parent_node = libMesh::invalid_uint;
+
+    /**
+     * Whether the bracketing nodes and \p point are set.  If not,
+     * add_node() has to find them itself, once earlier children
+     * exist.
+     */
+    bool has_location = false;
+
+    /**
+     * Where the pairs of nodes bracketing this one are stored, in the
+     * array of bracketing nodes filled by precompute_child_nodes().
+     */
+    std::size_t bracketing_begin = 0;
+    std::size_t bracketing_end = 0;
+
+    Point point;
+  };
+
+  /**
+   * Computes, in parallel, where the child nodes of \p elems[begin]
+   * through \p elems[end-1] will come from, for each element which
+   * has no children yet.  The nodes of child c of element
+   * \p elems[i] are stored from \p child_nodes[offsets[i-begin] +
+   * c*n_nodes] on, and the pairs of nodes bracketing them in
+   * \p bracketing_nodes.
+   */
+  void precompute_child_nodes (const std::vector<Elem *> & elems,
+                               std::size_t begin,
+                               std::size_t end,
+                               std::vector<std::size_t> & offsets,
+                               std::vector<PrecomputedChildNode> & child_nodes,
+                               std::vector<std::pair<dof_id_type, dof_id_type>> & bracketing_nodes) const;
+
   /**
    * Take user-specified coarsening flags and augment them
    * so that level-one dependency is satisfied.
@@ -764,6 +809,15 @@ private:
    */
   TopologyMap _new_nodes_map;
 
+  /**
+   * The element being refined by _refine_elements(), if its child
+   * nodes were precomputed, and those nodes and their bracketing
+   * nodes.
+   */
+  const Elem * _precomputed_parent;
+  const PrecomputedChildNode * _precomputed_child_nodes;
+  const std::pair<dof_id_type, dof_id_type> * _precomputed_bracketing_nodes;
+
   /**
    * Reference to the mesh.
    */
@@ -0,0 +1,128 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_SIDE_PAIR_H
+#define LIBMESH_SIDE_PAIR_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/stored_range.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class Elem;
+class MeshBase;
+
+/**
+ * One side of the active mesh, as seen from the active element which
+ * "owns" it for the purposes of face-based (e.g. DG or jump)
+ * integration.
+ *
+ * An interior side between two active elements of the same level is
+ * owned by the element with the smaller id.  An interior side between
+ * active elements of different levels is owned by the finer element,
+ * and its \p neighbor is then the coarser element.  A side with no
+ * neighbor is owned by its only element.  Each side of the active
+ * mesh is therefore owned by exactly one element.
+ *
+ * \brief An element side together with the element on its other side.
+ */
+struct SidePair
+{
+  /**
+   * How the levels of the two elements sharing a side are related.
+   */
+  enum LevelRelation : unsigned char
+    {
+      /**
+       * There is no neighbor: the side is on the domain boundary.
+       */
+      BOUNDARY,
+
+      /**
+       * The neighbor is an active element of the same level.
+       */
+      SAME_LEVEL,
+
+      /**
+       * The neighbor is an active element of a coarser level; the
+       * side is only part of the neighbor's side.
+       */
+      COARSER_NEIGHBOR
+    };
+
+  /**
+   * The element owning the side.
+   */
+  const Elem * elem;
+
+  /**
+   * The element on the other side, or \p nullptr on the boundary.
+   */
+  const Elem * neighbor;
+
+  /**
+   * The side number of the side on \p elem.
+   */
+  unsigned int side;
+
+  /**
+   * The side number of the side on \p neighbor, or \p invalid_uint on
+   * the boundary.
+   */
+  unsigned int neighbor_side;
+
+  LevelRelation relation;
+};
+
+typedef StoredRange<std::vector<SidePair>::const_iterator, SidePair> ConstSidePairRange;
+
+namespace MeshTools
+{
+
+/**
+ * Fills \p side_pairs with every side owned by an active local
+ * element of \p mesh, in the order in which the mesh iterates over
+ * its active local elements, and with all the sides of each element
+ * next to each other.  Sides with a remote neighbor are skipped.
+ *
+ * The neighbor links of \p mesh must be up to date.
+ */
+void find_side_pairs (const MeshBase & mesh,
+                      std::vector<SidePair> & side_pairs);
+
+/**
+ * \returns A range over \p mesh.side_pairs(), for use with
+ * \p Threads::parallel_for().  The range holds a copy of the list,
+ * but the elements it points to must not be used after the mesh has
+ * changed.  This should not be called within threads.
+ */
+ConstSidePairRange side_pair_range (const MeshBase & mesh,
+                                    const unsigned int grainsize = 1000);
+
+} // namespace MeshTools
+
+} // namespace libMesh
+
+#endif // LIBMESH_SIDE_PAIR_H
@@ -35,6 +35,7 @@
 
 // C++ includes
 #include <cstddef>
+#include <functional>
 #include <map>
 
 // Forward declarations
@@ -50,8 +51,9 @@ class MeshBase;
  * Format description:
  * cf. <a href="http://www.vtk.org/">VTK home page</a>.
  *
- * This class will not have any functionality unless VTK is detected
- * during configure and hence LIBMESH_HAVE_VTK is defined.
+ * Reading requires VTK to be detected during configure, so that
+ * LIBMESH_HAVE_VTK is defined.  Without VTK, meshes and nodal data
+ * can still be written with the native .pvtu writer.
  *
  * \author Wout Ruijter
  * \author John W. Peterson
@@ -85,14 +87,23 @@ public:
    * This method implements writing a mesh with nodal data to a
    * specified file where the nodal data and variable names are provided.
    *
-   * As with other Mesh IO classes, this interface is still still
-   * "available" when !LIBMESH_HAVE_VTK, however, it will throw a
-   * runtime error.
+   * When !LIBMESH_HAVE_VTK this uses the native writer, see
+   * set_native_writer().
    */
   virtual void write_nodal_data (const std::string &,
                                  const std::vector<Number> &,
                                  const std::vector<std::string> &) override;
 
+  /**
+   * With the native writer, each processor looks up only the values
+   * at the nodes of its own piece, so the nodal solution is never
+   * localized.  Otherwise this localizes the vector and calls the
+   * version above.
+   */
+  virtual void write_nodal_data (const std::string &,
+                                 const NumericVector<Number> &,
+                                 const std::vector<std::string> &) override;
+
   /**
    * This method implements reading a mesh from a specified file
    * in VTK format.
@@ -106,25 +117,45 @@ public:
   /**
    * Output the mesh without solutions to a .pvtu file.
    *
-   * As with other Mesh IO classes, this interface is still still
-   * "available" when !LIBMESH_HAVE_VTK, however, it will throw a
-   * runtime error.
+   * When !LIBMESH_HAVE_VTK this uses the native writer, see
+   * set_native_writer().
    */
   virtual void write (const std::string &) override;
 
-#ifdef LIBMESH_HAVE_VTK
-
   /**
    * Setter for compression flag
    */
   void set_compression(bool b);
 
+  /**
+   * Setter for the native writer flag.
+   *
+   * The native writer streams each processor's piece of the mesh and
+   * its nodal data straight from the mesh into a raw binary .vtu file,
+   * zlib compressed in blocks if compression is set, and writes the
+   * .pvtu file listing the pieces from processor 0.  Unlike the VTK
+   * writer it never builds a copy of the mesh in VTK data structures.
+   *
+   * The native writer is always used, whatever this flag says, when
+   * libMesh is built without VTK.
+   */
+  void set_native_writer(bool b);
+
+#ifdef LIBMESH_HAVE_VTK
+
   /**
    * Get a pointer to the VTK unstructured grid data structure.
    */
   vtkUnstructuredGrid * get_vtk_grid();
 
 private:
+  /**
+   * Writes the mesh and nodal solution with VTK.
+   */
+  void write_vtk_nodal_data (const std::string & fname,
+                             const std::vector<Number> & soln,
+                             const std::vector<std::string> & names);
+
   /**
    * write the nodes from the mesh into a vtkUnstructuredGrid and update the
    * local_node_map.
@@ -168,11 +199,6 @@ private:
    */
   vtkSmartPointer<vtkUnstructuredGrid> _vtk_grid;
 
-  /**
-   * Flag to indicate whether the output should be compressed
-   */
-  bool _compress;
-
   /**
    * maps global node id to node id of partition
    */
@@ -220,6 +246,30 @@ private:
   static std::map<ElemMappingType, ElementMaps> build_element_maps();
 
 #endif
+
+  /**
+   * Writes this processor's piece of the mesh to a .vtu file, and
+   * the .pvtu file listing every piece from processor 0.
+   * \p node_values fills its last argument with the values of the
+   * given variable at the given nodes; it is called on every
+   * processor for each variable in turn.
+   */
+  void write_native (const std::string & fname,
+                     const std::vector<std::string> & names,
+                     const std::function<void(std::size_t,
+                                              const std::vector<dof_id_type> &,
+                                              std::vector<Number> &)> & node_values);
+
+  /**
+   * Flag to indicate whether the output should be compressed
+   */
+  bool _compress;
+
+  /**
+   * Flag to indicate whether to write with the native writer even
+   * when VTK is available
+   */
+  bool _native_writer;
 };
 
 
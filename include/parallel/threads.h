@@ -190,6 +190,19 @@ public:
     _grainsize(r._grainsize)
   {}
 
+  /**
+   * Copy constructor which sets the beginning and end of the new
+   * range to \p first and \p last.  Pthreads requires this to divide
+   * a range among threads.
+   */
+  BlockedRange (const BlockedRange<T> & r,
+                const const_iterator first,
+                const const_iterator last):
+    _end(last),
+    _begin(first),
+    _grainsize(r._grainsize)
+  {}
+
   /**
    * Splits the range \p r.  The first half
    * of the range is left in place, the second
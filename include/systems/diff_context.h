@@ -114,6 +114,9 @@ public:
 
   /**
    * Non-const accessor for element solution.
+   *
+   * \note Code which modifies the element solution through this
+   * accessor must call elem_solution_changed() afterwards.
    */
   DenseVector<Number> & get_elem_solution()
   { return _elem_solution; }
@@ -138,6 +141,22 @@ public:
     return _elem_subsolutions[var];
   }
 
+  /**
+   * Discards any results cached from the element solution, e.g. sum
+   * factorized interior values in FEMContext.  Must be called after
+   * the element solution is set or modified, before it is used
+   * again.
+   */
+  void elem_solution_changed()
+  { ++_elem_solution_stamp; }
+
+  /**
+   * \returns A counter which changes whenever elem_solution_changed()
+   * is called.
+   */
+  unsigned int elem_solution_stamp() const
+  { return _elem_solution_stamp; }
+
   /**
    * Accessor for element solution rate of change w.r.t. time.
    */
@@ -582,6 +601,11 @@ protected:
   DenseVector<Number> _elem_solution;
   std::vector<DenseSubVector<Number>> _elem_subsolutions;
 
+  /**
+   * Incremented by elem_solution_changed().
+   */
+  unsigned int _elem_solution_stamp = 0;
+
   /**
    * Element by element components of du/dt
    * as adjusted by a time_solver
@@ -36,7 +36,9 @@
 
 // C++ includes
 #include <cstddef>
+#include <cstdint>
 #include <map>
+#include <optional>
 #include <set>
 #include <string>
 #include <string_view>
@@ -87,7 +89,9 @@ public:
   enum WriteFlags { WRITE_DATA             = 1,
                     WRITE_ADDITIONAL_DATA  = 2,
                     WRITE_PARALLEL_FILES   = 4,
-                    WRITE_SERIAL_FILES     = 8 };
+                    WRITE_SERIAL_FILES     = 8,
+                    WRITE_COMPRESSED       = 16,
+                    WRITE_INCREMENTAL      = 32 };
 
   /**
    * Constructor.
@@ -487,6 +491,22 @@ public:
    * \note The solution data can be omitted by calling
    * this routine with WRITE_DATA omitted in the write_flags argument.
    *
+   * With WRITE_COMPRESSED, the vectors of binary files are written
+   * in compressed chunks (see Xdr::set_compression()), losslessly
+   * unless a System::compression_tolerance() has been set.  read()
+   * recognizes such files by their version header.
+   *
+   * With WRITE_INCREMENTAL, a file is written in full the first time,
+   * and later writes with the same flags leave out any vector whose
+   * checksum matches the one it had in that full file, as long as the
+   * mesh generation and the systems and their vectors are the same.
+   * Such a delta file names the full one, by the name it was written
+   * under, and read() reads that file first and then the vectors in
+   * the delta, so the full file must not be moved or removed while
+   * its deltas are still needed.  Writes which would leave nothing
+   * out start a new full file instead.  Only the overloads taking a
+   * file name write deltas.
+   *
    * If XdrMODE is omitted, it will be inferred as WRITE for filenames
    * containing .xda or as ENCODE for filenames containing .xdr
    *
@@ -634,6 +654,36 @@ private:
    * shim lets us forward-declare DofMap.
    */
   void _remove_default_ghosting(unsigned int sys_num);
+
+  /**
+   * Implements write(), except that if \p base_name is not empty
+   * then this writes a delta file referring to \p base_name, and
+   * leaves out the vectors of each system marked in \p unchanged,
+   * solution first and then each additional vector.
+   */
+  void _write_impl (Xdr & io,
+                    const unsigned int write_flags,
+                    bool partition_agnostic,
+                    Xdr * const local_io,
+                    const std::string & base_name,
+                    const std::map<std::string, std::vector<bool>, std::less<>> & unchanged) const;
+
+  /**
+   * The last file write() wrote in full with WRITE_INCREMENTAL, with
+   * the settings and mesh generation it was written with, and the
+   * names and checksums of the vectors of each system, solution
+   * first.
+   */
+  struct FullWrite
+  {
+    std::string name;
+    unsigned int write_flags;
+    bool partition_agnostic;
+    std::size_t mesh_generation;
+    std::map<std::string, std::vector<std::string>, std::less<>> vector_names;
+    std::map<std::string, std::vector<std::uint64_t>, std::less<>> checksums;
+  };
+  mutable std::optional<FullWrite> _last_full_write;
 };
 
 
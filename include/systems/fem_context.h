@@ -33,6 +33,7 @@
 
 // C++ includes
 #include <map>
+#include <memory>
 #include <set>
 
 namespace libMesh
@@ -46,6 +47,7 @@ typedef FEGenericBase<Real> FEBase;
 class QBase;
 class Point;
 template <typename T> class NumericVector;
+class TensorProductEvaluator;
 
 /**
  * This class provides all data required for a physics package
@@ -790,6 +792,22 @@ public:
    */
   virtual void side_fe_reinit();
 
+  /**
+   * Copies the interior FE values computed by the most recent
+   * elem_fe_reinit(), which must have used the quadrature points, into
+   * \p values.  If \p values is empty, it is first filled with one FE
+   * object for each interior FE object of this context.
+   */
+  void copy_elem_fe_values(std::vector<std::unique_ptr<FEAbstract>> & values) const;
+
+  /**
+   * Exchanges the interior FE values with those stored in \p values by
+   * copy_elem_fe_values() on the current element, so they can be used
+   * again without another elem_fe_reinit().  Exchanging them a second
+   * time restores the values this context held before.
+   */
+  void swap_elem_fe_values(std::vector<std::unique_ptr<FEAbstract>> & values);
+
   /**
    * Reinitializes edge FE objects on the current geometric element
    */
@@ -1007,6 +1025,35 @@ public:
    */
   void set_jacobian_tolerance(Real tol);
 
+  /**
+   * Calls set_single_point_affine_map() on the maps of all the FE
+   * objects controlled by this class, so that elements with affine
+   * maps store their constant Jacobian data only once per element.
+   * Physics code using this must index any mapping derivatives it
+   * reads with FEMap::map_index().
+   */
+  void set_single_point_affine_map(bool single_point);
+
+  /**
+   * Enables or disables sum factorized evaluation in interior_value()
+   * and interior_gradient() for scalar variables.  When enabled, the
+   * first such call for a variable on an element evaluates it at
+   * every quadrature point at once with a TensorProductEvaluator, and
+   * later calls are served from those results until the FE objects
+   * are reinitialized or elem_solution_changed() is called.  Only
+   * nodal Lagrange variables on quadrilaterals and hexahedra are
+   * currently sum factorized; other variables keep using the usual
+   * loops.  Disabled by default.
+   */
+  void set_sum_factorization(bool enable)
+  { _sum_factorization = enable; }
+
+  /**
+   * \returns Whether sum factorized evaluation is enabled.
+   */
+  bool sum_factorization() const
+  { return _sum_factorization; }
+
   /**
    * Current side for side_* to examine
    */
@@ -1237,6 +1284,61 @@ protected:
    */
   int _extra_quadrature_order;
 
+  /**
+   * Whether to use sum factorized evaluation where possible.
+   */
+  bool _sum_factorization;
+
+  /**
+   * Incremented whenever the interior FE objects are reinitialized,
+   * so that stale sum factorized results are never used.
+   */
+  unsigned int _element_fe_stamp;
+
+  /**
+   * Whether the interior FE objects were last reinitialized at
+   * points other than those of the element quadrature rule.
+   */
+  bool _element_fe_custom_points;
+
+  /**
+   * Sum factorized results for one variable on the current element.
+   */
+  struct SumFactorizedVariable
+  {
+    unsigned int fe_stamp = 0;
+    unsigned int solution_stamp = 0;
+    const FEBase * fe = nullptr;
+    const TensorProductEvaluator * evaluator = nullptr;
+    std::vector<Number> values;
+    std::vector<Gradient> gradients;
+    bool have_values = false;
+    bool have_gradients = false;
+  };
+
+  mutable std::vector<SumFactorizedVariable> _sum_factorized_vars;
+
+  /**
+   * Tensor product evaluators for each interior FE object, along
+   * with the FE stamp they were last reinitialized at.
+   */
+  mutable std::map<const FEAbstract *,
+                   std::pair<unsigned int, std::unique_ptr<TensorProductEvaluator>>> _tensor_evaluators;
+
+  /**
+   * \returns Up to date sum factorized storage for variable \p var
+   * on the current element, or nullptr if sum factorization can't be
+   * used for it.
+   */
+  SumFactorizedVariable * sum_factorized_variable(unsigned int var) const;
+
+  /**
+   * Helper functions for interior_value() and interior_gradient().
+   * \returns \p false if sum factorization can't be used.
+   */
+  bool sum_factorized_value(unsigned int var, unsigned int qp, Number & u) const;
+  bool sum_factorized_gradient(unsigned int var, unsigned int qp, Gradient & du) const;
+
 private:
   /**
    * Helper function used in constructors to set up internal data.
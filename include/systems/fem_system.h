@@ -21,18 +21,25 @@
 #define LIBMESH_FEM_SYSTEM_H
 
 // Local Includes
+#include "libmesh/dense_matrix.h"
 #include "libmesh/diff_system.h"
 #include "libmesh/fem_physics.h"
 
 // C++ includes
 #include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace libMesh
 {
 
 // Forward Declarations
 class DiffContext;
+class FEAbstract;
 class FEMContext;
+class FEMSystemShellMatrix;
 
 
 /**
@@ -214,6 +221,16 @@ public:
    */
   Real verify_analytic_jacobians;
 
+  /**
+   * If this is true (as it is by default), matrix-free jacobian
+   * products store the interior FE values of each local element the
+   * first time they are computed, and later products reuse them
+   * rather than calling elem_fe_reinit() again.  This costs memory
+   * proportional to the number of shape functions times quadrature
+   * points on each element; set it to false if that is too much.
+   */
+  bool matrix_free_fe_value_cache;
+
   /**
    * Syntax sugar to make numerical_jacobian() declaration easier.
    */
@@ -247,6 +264,70 @@ public:
    */
   void numerical_nonlocal_jacobian (FEMContext & context) const;
 
+  /**
+   * Switches between assembling the jacobian into \p matrix (the
+   * default) and applying it element by element through a
+   * FEMSystemShellMatrix, which nonlinear solvers will then use in
+   * place of \p matrix.
+   *
+   * If this is set before the system is initialized, no system matrix
+   * is allocated at all, and assembly() may only be asked for
+   * residuals.  Preconditioners needing an assembled matrix must then
+   * be supplied through a "Preconditioner" matrix.
+   */
+  void set_matrix_free (bool use_matrix_free);
+
+  /**
+   * \returns \p true if the jacobian is applied matrix-free.
+   */
+  bool matrix_free () const { return _matrix_free; }
+
+  /**
+   * \returns The matrix-free jacobian if set_matrix_free() is on,
+   * otherwise \p nullptr.
+   */
+  virtual const ShellMatrix<Number> * get_jacobian_shell_matrix () const override;
+
+  /**
+   * Adds the product of the constrained jacobian, linearized about
+   * \p current_local_solution, with \p arg to \p dest.  \p arg must
+   * hold every entry in the send list, as a ghosted vector would.
+   * \p dest is not closed.
+   *
+   * Element jacobians are never formed: each element's contribution
+   * is a central difference of its residual along \p arg, with a step
+   * no larger than numerical_jacobian_h_for_var() in any variable, so
+   * products agree with those of the assembled jacobian only to
+   * within that differencing error.  Moving mesh systems still form
+   * the element jacobians.
+   */
+  void jacobian_vector_mult_add (NumericVector<Number> & dest,
+                                 const NumericVector<Number> & arg);
+
+  /**
+   * Adds the diagonal of the constrained jacobian, linearized about
+   * \p current_local_solution, to \p dest.  \p dest is not closed.
+   */
+  void jacobian_diagonal (NumericVector<Number> & dest);
+
+  /**
+   * Clears the data reused between matrix-free jacobian products,
+   * then reinitializes the system for a changed mesh.
+   */
+  virtual void reinit () override;
+
+  /**
+   * Clears the data reused between matrix-free jacobian products,
+   * which depends on the constraints, then rebuilds the constraints.
+   */
+  virtual void reinit_constraints () override;
+
+  /**
+   * Clears all data structures, including those reused between
+   * matrix-free jacobian products.
+   */
+  virtual void clear () override;
+
 protected:
   /**
    * Initializes the member data fields associated with
@@ -254,8 +335,95 @@ protected:
    */
   virtual void init_data () override;
 
+  /**
+   * Adds the system matrix, unless the jacobian is matrix-free.
+   */
+  virtual void add_matrices () override;
+
 private:
+  /**
+   * Loops over the local elements (and SCALAR equations) adding
+   * jacobian products with \p arg, or the jacobian diagonal if \p arg
+   * is null, into \p dest.
+   */
+  void apply_jacobian (const NumericVector<Number> * arg,
+                       NumericVector<Number> & dest);
+
+  /**
+   * Makes sure there is a (possibly not yet filled) entry in
+   * \p _matrix_free_elem_data for every active local element, and
+   * none left over from an older mesh.
+   */
+  void prepare_matrix_free_elem_data ();
+
+  /**
+   * Clears \p _matrix_free_elem_data and the ghosted argument of
+   * the matrix-free jacobian.
+   */
+  void clear_matrix_free_data ();
+
+  /**
+   * The threaded body of matrix-free jacobian products.
+   */
+  class MatrixFreeJacobianAction;
+
+  /**
+   * What matrix-free jacobian products reuse on one local element.
+   */
+  struct MatrixFreeElemData
+  {
+    /**
+     * The interior FE values, as stored by
+     * FEMContext::copy_elem_fe_values().
+     */
+    std::vector<std::unique_ptr<FEAbstract>> fe_values;
+
+    /**
+     * Whether the constraint data below has been built yet.
+     */
+    bool have_constraints = false;
+
+    /**
+     * If any element dofs are constrained, the element dof indices
+     * extended with those they are constrained in terms of, and the
+     * constraint matrix built for them by
+     * DofMap::build_constraint_matrix(); otherwise both are empty.
+     */
+    std::vector<dof_id_type> constrained_dof_indices;
+    DenseMatrix<Number> constraint_matrix;
+
+    /**
+     * For each constrained dof in \p constrained_dof_indices, its
+     * position there, along with the positions and coefficients of
+     * the dofs it is directly constrained in terms of.  These rows
+     * replace the constrained rows of the jacobian.
+     */
+    std::vector<std::pair<unsigned int,
+                          std::vector<std::pair<unsigned int, Real>>>> constraint_rows;
+  };
+
   std::vector<Real> _numerical_jacobian_h_for_var;
+
+  /**
+   * Whether the jacobian is applied matrix-free.
+   */
+  bool _matrix_free;
+
+  /**
+   * The matrix-free jacobian, built on demand.
+   */
+  std::unique_ptr<FEMSystemShellMatrix> _jacobian_shell_matrix;
+
+  /**
+   * Per element data reused by matrix-free jacobian products, keyed
+   * by element id.
+   */
+  std::unordered_map<dof_id_type, MatrixFreeElemData> _matrix_free_elem_data;
+
+  /**
+   * The mesh generation() \p _matrix_free_elem_data was built for.
+   */
+  std::size_t _matrix_free_elem_data_generation;
 };
 
 // --------------------------------------------------------------
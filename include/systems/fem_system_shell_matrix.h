@@ -0,0 +1,100 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FEM_SYSTEM_SHELL_MATRIX_H
+#define LIBMESH_FEM_SYSTEM_SHELL_MATRIX_H
+
+// Local includes
+#include "libmesh/shell_matrix.h"
+
+// C++ includes
+#include <memory>
+
+namespace libMesh
+{
+
+// Forward declarations
+class FEMSystem;
+
+/**
+ * The jacobian of a \p FEMSystem, linearized about the system's
+ * current_local_solution, represented only by its action on a vector.
+ *
+ * Every product is applied element by element, threaded over the
+ * active local elements, by central differencing element residuals
+ * along the argument (see FEMSystem::jacobian_vector_mult_add()), so
+ * neither a global sparse matrix nor element jacobians are ever
+ * formed.  Interior FE values and constraint matrices are computed
+ * for each element once and reused by later products until the
+ * system is reinitialized.  Constraints are applied as they are when
+ * the jacobian is assembled.  The diagonal is still taken from
+ * element jacobians.
+ *
+ * All overridden virtual functions are documented in shell_matrix.h.
+ *
+ * \brief Matrix-free FEMSystem jacobian.
+ */
+class FEMSystemShellMatrix : public ShellMatrix<Number>
+{
+public:
+  /**
+   * Constructor; takes a reference to the system, which must outlive
+   * this object.
+   */
+  explicit
+  FEMSystemShellMatrix (FEMSystem & sys);
+
+  /**
+   * Destructor.
+   */
+  virtual ~FEMSystemShellMatrix ();
+
+  virtual numeric_index_type m () const override;
+
+  virtual numeric_index_type n () const override;
+
+  virtual void vector_mult (NumericVector<Number> & dest,
+                            const NumericVector<Number> & arg) const override;
+
+  virtual void vector_mult_add (NumericVector<Number> & dest,
+                                const NumericVector<Number> & arg) const override;
+
+  virtual void get_diagonal (NumericVector<Number> & dest) const override;
+
+  virtual void clear () override;
+
+  virtual void init () override;
+
+protected:
+  /**
+   * The system whose jacobian we represent.
+   */
+  FEMSystem & _sys;
+
+  /**
+   * The argument of the last product, localized to include the
+   * entries every local element needs.  Cleared by FEMSystem whenever
+   * the system is reinitialized.
+   */
+  mutable std::unique_ptr<NumericVector<Number>> _localized_arg;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FEM_SYSTEM_SHELL_MATRIX_H
@@ -32,6 +32,7 @@ namespace libMesh
 
 // Forward declarations
 template <typename T> class LinearSolver;
+template <typename T> class ShellMatrix;
 class StaticCondensation;
 
 /**
@@ -163,6 +164,15 @@ public:
                          bool /* apply_no_constraints */ = false)
   { libmesh_not_implemented(); }
 
+  /**
+   * \returns A matrix-free representation of the system jacobian,
+   * which nonlinear solvers should apply instead of assembling into
+   * \p matrix, or \p nullptr (the default) if the jacobian is to be
+   * assembled.
+   */
+  virtual const ShellMatrix<Number> * get_jacobian_shell_matrix () const
+  { return nullptr; }
+
   /**
    * Residual parameter derivative function.
    *
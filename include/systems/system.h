@@ -1370,9 +1370,15 @@ public:
   /**
    * Writes additional data, namely vectors, for this System.
    * This method may safely be called on a distributed-memory mesh.
+   *
+   * If \p unchanged_vectors is given then this is part of an
+   * incremental delta file, and the vectors it marks as unchanged
+   * since the base file, solution first and then each additional
+   * vector, are not written.
    */
   void write_serialized_data (Xdr & io,
-                              const bool write_additional_data = true) const;
+                              const bool write_additional_data = true,
+                              const std::vector<bool> * unchanged_vectors = nullptr) const;
 
   /**
    * Serialize & write a number of identically distributed vectors.  This method
@@ -1387,9 +1393,15 @@ public:
    * This method may safely be called on a distributed-memory mesh.
    * This method will create an individual file for each processor in the simulation
    * where the local solution components for that processor will be stored.
+   *
+   * If \p unchanged_vectors is given then this is part of an
+   * incremental delta file, and the vectors it marks as unchanged
+   * since the base file, solution first and then each additional
+   * vector, are not written.
    */
   void write_parallel_data (Xdr & io,
-                            const bool write_additional_data) const;
+                            const bool write_additional_data,
+                            const std::vector<bool> * unchanged_vectors = nullptr) const;
 
   /**
    * \returns A string containing information about the
@@ -1815,6 +1827,14 @@ public:
    */
   bool & hide_output() { return _hide_output; }
 
+  /**
+   * Get/Set the absolute error allowed in this system's vectors when
+   * they are written with \p EquationSystems::WRITE_COMPRESSED.  The
+   * default of 0 compresses them losslessly.
+   */
+  Real   compression_tolerance() const { return _compression_tolerance; }
+  Real & compression_tolerance()       { return _compression_tolerance; }
+
 #ifdef LIBMESH_HAVE_METAPHYSICL
   /**
    * This method creates a projection matrix which corresponds to the
@@ -2264,6 +2284,14 @@ private:
    */
   unsigned int _additional_data_written;
 
+  /**
+   * This flag is used only when *reading* in a system from file.
+   * Based on the version header, it is \p true if the file is an
+   * incremental delta, in which only the vectors which changed since
+   * its base file are written.
+   */
+  bool _written_as_delta;
+
   /**
    * This vector is used only when *reading* in a system from file.
    * Based on the system header, it keeps track of any index remapping
@@ -2289,6 +2317,11 @@ private:
    */
   bool _hide_output;
 
+  /**
+   * The absolute error allowed when writing compressed vectors.
+   */
+  Real _compression_tolerance;
+
   /**
    * Do we want to apply constraints while projecting vectors ?
    */
@@ -28,6 +28,7 @@
 // http://stackoverflow.com/questions/237370/does-stdsize-t-make-sense-in-c
 #include <stddef.h>
 #include <stdint.h> // uint32_t, uint64_t
+#include <cstring> // std::memcpy
 #include <vector>
 
 #include "libmesh_common.h" // libmesh_error_msg(), libmesh_fallthrough
@@ -295,6 +296,27 @@ uint16_t hashword(const uint16_t * k, size_t length)
 }
 
 
+/**
+ * \returns A 64-bit hash of the value of \p r.  The value is hashed
+ * as a pair of doubles, rather than as the bytes of \p r, so padding
+ * in wider Real types is ignored, and values which agree to about
+ * twice double precision hash the same.
+ */
+inline
+uint64_t hashreal(const Real r)
+{
+  const double hi = static_cast<double>(r);
+  const double lo = static_cast<double>(r - hi);
+
+  uint64_t k[2];
+  std::memcpy(&k[0], &hi, sizeof(double));
+  std::memcpy(&k[1], &lo, sizeof(double));
+
+  return hashword(k, 2);
+}
+
+
+
 /**
  * Calls functions above with slightly more convenient
  * std::vector/array compatible interface.
@@ -0,0 +1,91 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2024 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_OBJECT_POOL_H
+#define LIBMESH_OBJECT_POOL_H
+
+// C++ includes
+#include <cstddef>
+
+namespace libMesh
+{
+
+/**
+ * Thread-safe pooled storage for the many small, long-lived objects
+ * a mesh is made of.  \p Node and \p Elem allocate themselves from
+ * here via class-specific operators new and delete.
+ *
+ * Requests are rounded up to a multiple of the fundamental alignment,
+ * and each size class is carved out of large chunks, so objects of
+ * the same type which are built one after another, as in mesh
+ * generation, reading and refinement, are adjacent in memory.
+ * Freed objects are kept for reuse by later objects of the same size
+ * class.  Whenever the last slot of a chunk is freed, that chunk is
+ * returned to the system, unless it is the only one of its size class.
+ *
+ * Each thread keeps a few free slots of each size class to itself,
+ * and fetches or returns them in batches, so threads building and
+ * destroying temporary elements rarely contend for a lock.  A
+ * thread's cached slots are returned when it exits, or when it calls
+ * flush_thread_cache() or release_memory().
+ *
+ * Requests too large to be worth pooling go straight to the global
+ * allocator.
+ *
+ * \brief Size class pools for Node and Elem storage.
+ */
+class ObjectPool
+{
+public:
+  /**
+   * \returns Storage for an object of \p size bytes.
+   */
+  static void * allocate (std::size_t size);
+
+  /**
+   * Returns storage for an object of \p size bytes, which must have
+   * come from allocate() with the same \p size.
+   */
+  static void deallocate (void * p, std::size_t size);
+
+  /**
+   * Returns the free slots cached by the calling thread to the shared
+   * pools.
+   */
+  static void flush_thread_cache ();
+
+  /**
+   * Flushes the calling thread's cache, then frees every chunk of each
+   * size class which has no live objects.  Slots cached by other
+   * threads count as live.
+   *
+   * \returns \p true if any memory was freed.
+   */
+  static bool release_memory ();
+
+  /**
+   * \returns The number of chunks currently allocated for objects of
+   * \p size bytes, or 0 if such objects are not pooled.
+   */
+  static std::size_t n_chunks (std::size_t size);
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_OBJECT_POOL_H
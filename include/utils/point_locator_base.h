@@ -97,6 +97,21 @@ public:
   virtual const Elem * operator() (const Point & p,
                                    const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const = 0;
 
+  /**
+   * Locates an element containing each of \p points, and stores them
+   * in the corresponding entries of \p elems, or \p nullptr where
+   * \p operator() would find none.  Optionally allows the user to
+   * restrict the subdomains searched.  A point on the boundary
+   * between elements may be given a different one of them than
+   * \p operator() would return.
+   *
+   * Subclasses can override this to share work between nearby
+   * points; the base class just loops over \p operator().
+   */
+  virtual void locate (const std::vector<Point> & points,
+                       std::vector<const Elem *> & elems,
+                       const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const;
+
   /**
    * Locates a set of elements in proximity to the point with global coordinates
    * \p p  Pure virtual. Optionally allows the user to restrict the subdomains searched.
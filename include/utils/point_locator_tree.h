@@ -116,6 +116,24 @@ public:
                            std::set<const Elem *> & candidate_elements,
                            const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const override final;
 
+  /**
+   * Locates an element containing each of \p points, as \p operator()
+   * does for a single point, although points on the boundary between
+   * elements may be given a different one of them.
+   *
+   * The points are visited in Morton order, so that consecutive points
+   * tend to fall in the same bin of the tree.  The tree is only
+   * searched for points outside the bin of the previous point, and
+   * the loose bounding boxes of that bin's elements are gathered only
+   * once per run of such points.  Each point is then tested against all of those boxes
+   * at once, and only elements whose boxes contain it are handed to
+   * the (much more expensive) inverse map of \p contains_point().
+   * Points this does not locate fall back to \p operator().
+   */
+  virtual void locate (const std::vector<Point> & points,
+                       std::vector<const Elem *> & elems,
+                       const std::set<subdomain_id_type> * allowed_subdomains = nullptr) const override final;
+
   /**
    * As a fallback option, it's helpful to be able to do a linear
    * search over the entire mesh. This can be used if operator()
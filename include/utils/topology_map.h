@@ -72,6 +72,14 @@ public:
                 std::pair<dof_id_type, dof_id_type>> &
                 bracketing_nodes);
 
+  /**
+   * As above, for the bracketing node pairs from \p bracketing_begin
+   * up to \p bracketing_end.
+   */
+  void add_node(const Node & mid_node,
+                const std::pair<dof_id_type, dof_id_type> * bracketing_begin,
+                const std::pair<dof_id_type, dof_id_type> * bracketing_end);
+
   bool empty() const { return _map.empty(); }
 
   dof_id_type find(dof_id_type bracket_node1,
@@ -81,6 +89,9 @@ public:
                    std::pair<dof_id_type, dof_id_type>> &
                    bracketing_nodes) const;
 
+  dof_id_type find(const std::pair<dof_id_type, dof_id_type> * bracketing_begin,
+                   const std::pair<dof_id_type, dof_id_type> * bracketing_end) const;
+
 protected:
   void fill(const MeshBase &);
 
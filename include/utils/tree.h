@@ -87,6 +87,18 @@ public:
                                     const std::set<subdomain_id_type> * allowed_subdomains = nullptr,
                                     Real relative_tol = TOLERANCE) const override;
 
+  /**
+   * \returns The elements of the bin whose bounding box contains
+   * point \p p, or \p nullptr if no bin does.  The elements are not
+   * tested, so they need not contain \p p themselves.  If \p bin_box
+   * is given, it is set to the bounding box of that bin, grown by the
+   * tolerance, so that later points it contains can be given the same
+   * bin without searching the tree again.
+   */
+  virtual const std::vector<const Elem *> * find_bin(const Point & p,
+                                                     Real relative_tol = TOLERANCE,
+                                                     BoundingBox * bin_box = nullptr) const override;
+
   /**
    * Fills \p candidate_elements with any elements containing the
    * specified point \p p,
@@ -178,6 +178,18 @@ public:
                       const std::set<subdomain_id_type> * allowed_subdomains = nullptr,
                       Real relative_tol = TOLERANCE) const;
 
+  /**
+   * \returns The elements stored in an active TreeNode whose bounding
+   * box contains point \p p, or \p nullptr if there is none.  Unlike
+   * find_element(), this neither tests any of the elements nor
+   * searches other bins if they do not contain \p p.  If \p bin_box
+   * is given, it is set to the bounding box of that TreeNode, grown by
+   * the tolerance.
+   */
+  const std::vector<const Elem *> * find_bin (const Point & p,
+                                              Real relative_tol = TOLERANCE,
+                                              BoundingBox * bin_box = nullptr) const;
+
 private:
   /**
    * Look for point \p p in our children,
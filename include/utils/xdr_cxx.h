@@ -60,6 +60,10 @@ namespace libMesh
  * created to handle equation system output as a replacement for
  * XdrIO since that is somewhat limited.
  *
+ * Where the system supports it, binary files opened for DECODE are
+ * mapped into memory and decoded in place, with arrays of values
+ * decoded in bulk rather than one XDR call at a time.
+ *
  * \author Benjamin Kirk
  * \date 2003
  * \brief C++ interface for the XDR (eXternal Data Representation) format.
@@ -165,6 +169,23 @@ public:
    */
   void comment (std::string &);
 
+  /**
+   * Turns block compression on or off for the floating point arrays
+   * hereafter written or read with data_stream(), or with data() on
+   * vectors of real or complex values.  Arrays are split into chunks
+   * whose bytes are shuffled and then deflated with zlib.  When
+   * encoding with a positive \p tolerance, values are first quantized
+   * to within that absolute error.  Compression is only available for
+   * binary files, in builds with zlib (gzstream) support, and must be
+   * turned on for exactly the same data when reading as when writing.
+   */
+  void set_compression (bool enable, Real tolerance = 0);
+
+  /**
+   * \returns \p true if floating point arrays are being compressed.
+   */
+  bool compression () const { return fp_compression; }
+
   /**
    * Sets the version of the file that is being read
    */
@@ -214,6 +235,11 @@ private:
   void _complex_data_stream (std::complex<T> * val, const unsigned int len,
                              const unsigned int line_break);
 
+  /**
+   * Helper method for compressed FP arrays
+   */
+  void _compressed_fp_stream (double * val, const unsigned int len);
+
   /**
    * Helper method for extended FP types
    */
@@ -251,6 +277,13 @@ private:
    */
   FILE * fp;
 
+  /**
+   * When decoding a file we can map into memory, the mapping, which
+   * \p xdrs then decodes in place instead of through \p fp.
+   */
+  char * mapped_file;
+  std::size_t mapped_size;
+
 #endif
 
   /**
@@ -278,6 +311,13 @@ private:
    * Version of the file being read
    */
   int version_number;
+
+  /**
+   * Are we compressing floating point arrays, and to within what
+   * absolute error?
+   */
+  bool fp_compression;
+  Real fp_compression_tolerance;
 };
 
 
@@ -200,6 +200,9 @@ AC_CHECK_FUNCS([mkstemp gettimeofday])
 # Check for uname header.
 AC_CHECK_HEADERS(sys/utsname.h)
 
+# Check for mmap, used for reading binary XDR files in place.
+AC_CHECK_HEADERS(sys/mman.h)
+
 AC_ARG_ENABLE(unordered-containers,
               AS_HELP_STRING([--disable-unordered-containers],
                              [Use map/set instead of unordered_map/unordered_set (no longer supported)]),